@@ -0,0 +1,108 @@
+/**
+ * AD5667.c
+ *
+ * This file is part of the LibTiePie programming examples.
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#include "AD5667.h"
+#include <stdlib.h>
+
+bool8_t ad5667QueueInit(AD5667Queue_t* queue, LibTiePieHandle_t i2c, uint16_t address, uint32_t frameMax)
+{
+  queue->data = malloc(AD5667_FRAME_SIZE * (frameMax > 0 ? frameMax : 1));
+  if(!queue->data)
+    return BOOL8_FALSE;
+
+  queue->i2c = i2c;
+  queue->address = address;
+  queue->length = 0;
+  queue->frameMax = frameMax > 0 ? frameMax : 1;
+  queue->batched = BOOL8_TRUE;
+  queue->writeCount = 0;
+  queue->frameCount = 0;
+
+  return BOOL8_TRUE;
+}
+
+void ad5667QueueFree(AD5667Queue_t* queue)
+{
+  free(queue->data);
+  queue->data = NULL;
+  queue->length = 0;
+}
+
+bool8_t ad5667QueueCommand(AD5667Queue_t* queue, uint8_t command, uint16_t value)
+{
+  bool8_t result = BOOL8_TRUE;
+
+  if(queue->length + AD5667_FRAME_SIZE > queue->frameMax * AD5667_FRAME_SIZE)
+    result = ad5667QueueFlush(queue);
+
+  uint8_t* frame = queue->data + queue->length;
+  frame[0] = command;
+  frame[1] = (uint8_t)(value >> 8);
+  frame[2] = (uint8_t)value;
+  queue->length += AD5667_FRAME_SIZE;
+
+  return result;
+}
+
+bool8_t ad5667QueueSetBoth(AD5667Queue_t* queue, uint16_t valueA, uint16_t valueB)
+{
+  if(valueA == valueB)
+    return ad5667QueueCommand(queue, AD5667_CMD_WRITE_UPDATE | AD5667_REG_DAC_ALL, valueA);
+
+  // Write A without update, then write B and update both outputs at once:
+  const bool8_t result = ad5667QueueCommand(queue, AD5667_CMD_WRITE | AD5667_REG_DAC_A, valueA);
+  return ad5667QueueCommand(queue, AD5667_CMD_WRITE_UPDATE_ALL | AD5667_REG_DAC_B, valueB) && result;
+}
+
+bool8_t ad5667QueueFlush(AD5667Queue_t* queue)
+{
+  const uint32_t frames = queue->length / AD5667_FRAME_SIZE;
+  bool8_t batchFailed = BOOL8_FALSE;
+  bool8_t result = BOOL8_TRUE;
+
+  if(frames == 0)
+    return BOOL8_TRUE;
+
+  if(queue->batched && frames > 1)
+  {
+    // All frames in one transaction:
+    queue->writeCount++;
+    if(I2CWrite(queue->i2c, queue->address, queue->data, queue->length, BOOL8_TRUE))
+    {
+      queue->frameCount += frames;
+      queue->length = 0;
+      return BOOL8_TRUE;
+    }
+
+    batchFailed = BOOL8_TRUE;
+  }
+
+  for(uint32_t i = 0; i < frames; i++)
+  {
+    const uint8_t* frame = queue->data + i * AD5667_FRAME_SIZE;
+
+    queue->writeCount++;
+    if(I2CWriteByteWord(queue->i2c, queue->address, frame[0], (uint16_t)((frame[1] << 8) | frame[2])))
+    {
+      queue->frameCount++;
+
+      // The batch failed but a single frame works, so the host refuses multi-frame writes, send frames one by one from now on:
+      if(batchFailed)
+      {
+        queue->batched = BOOL8_FALSE;
+        batchFailed = BOOL8_FALSE;
+      }
+    }
+    else
+      result = BOOL8_FALSE;
+  }
+
+  queue->length = 0;
+
+  return result;
+}
@@ -0,0 +1,64 @@
+/**
+ * AD5667.h
+ *
+ * This file is part of the LibTiePie programming examples.
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#ifndef _AD5667_H_
+#define _AD5667_H_
+
+#include <libtiepie.h>
+
+// Batched writes to an Analog Devices AD5667 dual 16-bit DAC on an I2C host.
+// Each DAC command is a frame of three bytes: command | register, value MSB, value LSB.
+// Frames are queued and sent as one I2CWrite() per batch, instead of one I2CWriteByteWord() call per frame.
+// If the host refuses a multi-frame write while single frames are accepted, the queue falls back to one call per frame.
+
+// AD5667 address:
+#define AD5667_ADDRESS 12
+
+// AD5667 registers:
+#define AD5667_REG_DAC_A   0x00
+#define AD5667_REG_DAC_B   0x01
+#define AD5667_REG_DAC_ALL 0x07
+
+// AD5667 commands:
+#define AD5667_CMD_WRITE            0x00
+#define AD5667_CMD_UPDATE           0x08
+#define AD5667_CMD_WRITE_UPDATE_ALL 0x10
+#define AD5667_CMD_WRITE_UPDATE     0x18
+#define AD5667_CMD_POWER            0x20
+#define AD5667_CMD_RESET            0x28
+#define AD5667_CMD_LDAC_SETUP       0x30
+#define AD5667_CMD_REF_SETUP        0x38
+
+#define AD5667_FRAME_SIZE 3 // Bytes.
+
+typedef struct
+{
+  LibTiePieHandle_t i2c;
+  uint16_t address;
+  uint8_t* data;
+  uint32_t length; // Bytes queued.
+  uint32_t frameMax; // Frames per I2C write.
+  bool8_t batched; // BOOL8_FALSE after the host refused a multi-frame write but accepted a single frame.
+  uint64_t writeCount; // I2C calls.
+  uint64_t frameCount;
+} AD5667Queue_t;
+
+// Returns BOOL8_FALSE if out of memory:
+bool8_t ad5667QueueInit(AD5667Queue_t* queue, LibTiePieHandle_t i2c, uint16_t address, uint32_t frameMax);
+void ad5667QueueFree(AD5667Queue_t* queue);
+
+// Queue one frame, a full queue is flushed first:
+bool8_t ad5667QueueCommand(AD5667Queue_t* queue, uint8_t command, uint16_t value);
+
+// Queue a simultaneous update of both DACs, one frame when the values are equal, two otherwise:
+bool8_t ad5667QueueSetBoth(AD5667Queue_t* queue, uint16_t valueA, uint16_t valueB);
+
+// Send all queued frames. Returns BOOL8_FALSE on error:
+bool8_t ad5667QueueFlush(AD5667Queue_t* queue);
+
+#endif
@@ -8,9 +8,12 @@
 
 #include "CheckStatus.h"
 #include <stdio.h>
-#include <libtiepie.h>
+#include <stdlib.h>
 #include "Utils.h" // for NEWLINE
 
+static StatusSite_t* sites = NULL; // Lock free list of call sites that recorded a status.
+static uint8_t atExitRegistered = 0;
+
 void checkLastStatus(const char* file, unsigned int line)
 {
   LibTiePieStatus_t status = LibGetLastStatus();
@@ -20,3 +23,41 @@ void checkLastStatus(const char* file, unsigned int line)
   else if(status > LIBTIEPIESTATUS_SUCCESS)
     fprintf(stderr, "%s:%u Warning: %s" NEWLINE, file, line, LibGetLastStatusStr());
 }
+
+void recordStatus(StatusSite_t* site, LibTiePieStatus_t status)
+{
+  if(status < LIBTIEPIESTATUS_SUCCESS)
+    __atomic_fetch_add(&site->errorCount, 1, __ATOMIC_RELAXED);
+  else
+    __atomic_fetch_add(&site->warningCount, 1, __ATOMIC_RELAXED);
+
+  // The status string is a constant in the library, so keeping the pointer is fine:
+  __atomic_store_n(&site->lastStatusStr, LibGetLastStatusStr(), __ATOMIC_RELAXED);
+
+  // Add call site to the list on first use:
+  if(!__atomic_exchange_n(&site->registered, 1, __ATOMIC_ACQ_REL))
+  {
+    StatusSite_t* head = __atomic_load_n(&sites, __ATOMIC_RELAXED);
+    do
+    {
+      site->next = head;
+    }
+    while(!__atomic_compare_exchange_n(&sites, &head, site, 1, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+
+    if(!__atomic_exchange_n(&atExitRegistered, 1, __ATOMIC_ACQ_REL))
+      atexit(printStatusReport);
+  }
+}
+
+void printStatusReport()
+{
+  for(StatusSite_t* site = __atomic_load_n(&sites, __ATOMIC_ACQUIRE); site; site = site->next)
+  {
+    const uint32_t errorCount = __atomic_exchange_n(&site->errorCount, 0, __ATOMIC_RELAXED);
+    const uint32_t warningCount = __atomic_exchange_n(&site->warningCount, 0, __ATOMIC_RELAXED);
+    const char* statusStr = __atomic_load_n(&site->lastStatusStr, __ATOMIC_RELAXED);
+
+    if(errorCount > 0 || warningCount > 0)
+      fprintf(stderr, "%s:%u %u error(s), %u warning(s), last: %s" NEWLINE, site->file, site->line, errorCount, warningCount, statusStr);
+  }
+}
@@ -9,8 +9,43 @@
 #ifndef _CHECKSTATUS_H_
 #define _CHECKSTATUS_H_
 
+#include <stdint.h>
+#include <libtiepie.h>
+
 #define CHECK_LAST_STATUS() checkLastStatus(__FILE__, __LINE__);
 
+// Fast status check for hot loops, only reads the status.
+// Warnings and errors are counted per call site and printed by printStatusReport(), which is also called at exit.
+// Define CHECK_STATUS_STRIP_FAST to remove these checks completely.
+#ifdef CHECK_STATUS_STRIP_FAST
+#  define CHECK_LAST_STATUS_FAST() do {} while(0)
+#else
+#  define CHECK_LAST_STATUS_FAST() \
+  do \
+  { \
+    const LibTiePieStatus_t checkStatus_ = LibGetLastStatus(); \
+    if(checkStatus_ != LIBTIEPIESTATUS_SUCCESS) \
+    { \
+      static StatusSite_t checkSite_ = {.file = __FILE__, .line = __LINE__}; \
+      recordStatus(&checkSite_, checkStatus_); \
+    } \
+  } while(0)
+#endif
+
+typedef struct StatusSite
+{
+  const char* file;
+  unsigned int line;
+  uint32_t errorCount;
+  uint32_t warningCount;
+  const char* lastStatusStr;
+  uint8_t registered;
+  struct StatusSite* next;
+} StatusSite_t;
+
 void checkLastStatus(const char* file, unsigned int line);
 
+void recordStatus(StatusSite_t* site, LibTiePieStatus_t status);
+void printStatusReport(); // Prints and clears the counts of all call sites.
+
 #endif
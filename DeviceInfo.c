@@ -0,0 +1,545 @@
+/**
+ * DeviceInfo.c
+ *
+ * This file is part of the LibTiePie programming examples.
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#include "DeviceInfo.h"
+#include <stdlib.h>
+#include <pthread.h>
+
+typedef uint32_t (*GetStringFunction_t)(LibTiePieHandle_t handle, char* buffer, uint32_t length);
+
+static char* getString(GetStringFunction_t function, LibTiePieHandle_t handle)
+{
+  const uint32_t length = function(handle, NULL, 0) + 1; // Add one for the terminating zero
+  char* s = malloc(sizeof(char) * length);
+  function(handle, s, length);
+  return s;
+}
+
+// Returns BOOL8_TRUE if the previous call was supported by the device:
+static bool8_t isSupported()
+{
+  return LibGetLastStatus() != LIBTIEPIESTATUS_NOT_SUPPORTED;
+}
+
+LibraryInfo_t* getLibraryInfo()
+{
+  LibraryInfo_t* info = calloc(1, sizeof(LibraryInfo_t));
+
+  info->version = LibGetVersion();
+  info->versionExtra = LibGetVersionExtra();
+  info->configLength = LibGetConfig(NULL, 0);
+  info->config = malloc(sizeof(uint8_t) * info->configLength);
+  info->configLength = LibGetConfig(info->config, info->configLength);
+
+  return info;
+}
+
+void freeLibraryInfo(LibraryInfo_t* info)
+{
+  if(info)
+  {
+    free(info->config);
+    free(info);
+  }
+}
+
+static void* getTriggerInputsOutputsInfo(void* arg)
+{
+  DeviceInfo_t* info = arg;
+  const LibTiePieHandle_t dev = info->handle;
+
+  info->triggerInputCount = DevTrGetInputCount(dev);
+  info->triggerInputs = calloc(info->triggerInputCount, sizeof(TriggerInputInfo_t));
+
+  for(uint16_t i = 0; i < info->triggerInputCount; i++)
+  {
+    TriggerInputInfo_t* input = &info->triggerInputs[i];
+
+    input->id = DevTrInGetId(dev, i);
+
+    const uint32_t length = DevTrInGetName(dev, i, NULL, 0) + 1;
+    input->name = malloc(sizeof(char) * length);
+    DevTrInGetName(dev, i, input->name, length);
+
+    input->isAvailable = DevTrInIsAvailable(dev, i);
+    if(input->isAvailable)
+    {
+      input->isEnabled = DevTrInGetEnabled(dev, i);
+      input->kinds = DevTrInGetKinds(dev, i);
+      if(input->kinds != TKM_NONE)
+        input->kind = DevTrInGetKind(dev, i);
+    }
+  }
+
+  info->triggerOutputCount = DevTrGetOutputCount(dev);
+  info->triggerOutputs = calloc(info->triggerOutputCount, sizeof(TriggerOutputInfo_t));
+
+  for(uint16_t i = 0; i < info->triggerOutputCount; i++)
+  {
+    TriggerOutputInfo_t* output = &info->triggerOutputs[i];
+
+    output->id = DevTrOutGetId(dev, i);
+
+    const uint32_t length = DevTrOutGetName(dev, i, NULL, 0) + 1;
+    output->name = malloc(sizeof(char) * length);
+    DevTrOutGetName(dev, i, output->name, length);
+
+    output->isEnabled = DevTrOutGetEnabled(dev, i);
+    output->events = DevTrOutGetEvents(dev, i);
+    output->event = DevTrOutGetEvent(dev, i);
+  }
+
+  return NULL;
+}
+
+static void getChannelInfo(LibTiePieHandle_t scp, uint16_t ch, ChannelInfo_t* info)
+{
+  info->connectorType = ScpChGetConnectorType(scp, ch);
+  info->isDifferential = ScpChIsDifferential(scp, ch);
+  info->impedance = ScpChGetImpedance(scp, ch);
+  info->hasConnectionTest = ScpChHasConnectionTest(scp, ch);
+  info->isAvailable = ScpChIsAvailable(scp, ch);
+  info->isEnabled = ScpChGetEnabled(scp, ch);
+
+  info->bandwidthCount = ScpChGetBandwidths(scp, ch, NULL, 0);
+  info->bandwidths = malloc(sizeof(double) * info->bandwidthCount);
+  info->bandwidthCount = ScpChGetBandwidths(scp, ch, info->bandwidths, info->bandwidthCount);
+  info->bandwidth = ScpChGetBandwidth(scp, ch);
+
+  info->couplings = ScpChGetCouplings(scp, ch);
+  info->coupling = ScpChGetCoupling(scp, ch);
+  info->autoRanging = ScpChGetAutoRanging(scp, ch);
+
+  info->rangeCount = ScpChGetRanges(scp, ch, NULL, 0);
+  info->ranges = malloc(sizeof(double) * info->rangeCount);
+  info->rangeCount = ScpChGetRanges(scp, ch, info->ranges, info->rangeCount);
+  info->range = ScpChGetRange(scp, ch);
+
+  info->probeGain = ScpChGetProbeGain(scp, ch);
+  info->probeOffset = ScpChGetProbeOffset(scp, ch);
+
+  info->hasSafeGround = ScpChHasSafeGround(scp, ch);
+  if(info->hasSafeGround)
+  {
+    info->safeGroundEnabled = ScpChGetSafeGroundEnabled(scp, ch);
+    info->safeGroundThresholdMin = ScpChGetSafeGroundThresholdMin(scp, ch);
+    info->safeGroundThresholdMax = ScpChGetSafeGroundThresholdMax(scp, ch);
+    info->safeGroundThreshold = ScpChGetSafeGroundThreshold(scp, ch);
+  }
+
+  info->hasTrigger = ScpChHasTrigger(scp, ch);
+  if(info->hasTrigger)
+  {
+    ChannelTriggerInfo_t* trigger = &info->trigger;
+
+    trigger->isAvailable = ScpChTrIsAvailable(scp, ch);
+    trigger->isEnabled = ScpChTrGetEnabled(scp, ch);
+    trigger->kinds = ScpChTrGetKinds(scp, ch);
+    trigger->kind = ScpChTrGetKind(scp, ch);
+    trigger->levelModes = ScpChTrGetLevelModes(scp, ch);
+    trigger->levelMode = ScpChTrGetLevelMode(scp, ch);
+
+    trigger->levelCount = ScpChTrGetLevelCount(scp, ch);
+    trigger->levels = malloc(sizeof(double) * trigger->levelCount);
+    for(uint32_t i = 0; i < trigger->levelCount; i++)
+      trigger->levels[i] = ScpChTrGetLevel(scp, ch, i);
+
+    trigger->hysteresisCount = ScpChTrGetHysteresisCount(scp, ch);
+    trigger->hystereses = malloc(sizeof(double) * trigger->hysteresisCount);
+    for(uint32_t i = 0; i < trigger->hysteresisCount; i++)
+      trigger->hystereses[i] = ScpChTrGetHysteresis(scp, ch, i);
+
+    trigger->conditions = ScpChTrGetConditions(scp, ch);
+    if(trigger->conditions != TCM_NONE)
+      trigger->condition = ScpChTrGetCondition(scp, ch);
+
+    trigger->timeCount = ScpChTrGetTimeCount(scp, ch);
+    trigger->times = malloc(sizeof(double) * trigger->timeCount);
+    for(uint32_t i = 0; i < trigger->timeCount; i++)
+      trigger->times[i] = ScpChTrGetTime(scp, ch, i);
+  }
+}
+
+static void getOscilloscopeInfo(LibTiePieHandle_t scp, OscilloscopeInfo_t* info)
+{
+  info->channelCount = ScpGetChannelCount(scp);
+  info->hasConnectionTest = ScpHasConnectionTest(scp);
+  info->measureModes = ScpGetMeasureModes(scp);
+  info->measureMode = ScpGetMeasureMode(scp);
+  info->autoResolutionModes = ScpGetAutoResolutionModes(scp);
+  info->autoResolutionMode = ScpGetAutoResolutionMode(scp);
+
+  info->resolutionCount = ScpGetResolutions(scp, NULL, 0);
+  info->resolutions = malloc(sizeof(uint8_t) * info->resolutionCount);
+  info->resolutionCount = ScpGetResolutions(scp, info->resolutions, info->resolutionCount);
+  info->resolution = ScpGetResolution(scp);
+  info->isResolutionEnhanced = ScpIsResolutionEnhanced(scp);
+
+  info->clockOutputs = ScpGetClockOutputs(scp);
+  info->clockOutput = ScpGetClockOutput(scp);
+  info->clockOutputFrequencyCount = ScpGetClockOutputFrequencies(scp, NULL, 0);
+  if(info->clockOutputFrequencyCount > 0)
+  {
+    info->clockOutputFrequencies = malloc(sizeof(double) * info->clockOutputFrequencyCount);
+    info->clockOutputFrequencyCount = ScpGetClockOutputFrequencies(scp, info->clockOutputFrequencies, info->clockOutputFrequencyCount);
+    info->clockOutputFrequency = ScpGetClockOutputFrequency(scp);
+  }
+
+  info->clockSources = ScpGetClockSources(scp);
+  info->clockSource = ScpGetClockSource(scp);
+  info->clockSourceFrequencyCount = ScpGetClockSourceFrequencies(scp, NULL, 0);
+  if(info->clockSourceFrequencyCount > 0)
+  {
+    info->clockSourceFrequencies = malloc(sizeof(double) * info->clockSourceFrequencyCount);
+    info->clockSourceFrequencyCount = ScpGetClockSourceFrequencies(scp, info->clockSourceFrequencies, info->clockSourceFrequencyCount);
+    info->clockSourceFrequency = ScpGetClockSourceFrequency(scp);
+  }
+
+  info->recordLengthMax = ScpGetRecordLengthMax(scp);
+  info->recordLength = ScpGetRecordLength(scp);
+  info->sampleFrequencyMax = ScpGetSampleFrequencyMax(scp);
+  info->sampleFrequency = ScpGetSampleFrequency(scp);
+
+  if(info->measureMode == MM_BLOCK)
+  {
+    info->segmentCountMax = ScpGetSegmentCountMax(scp);
+    info->segmentCount = ScpGetSegmentCount(scp);
+  }
+
+  info->hasTrigger = ScpHasTrigger(scp);
+  if(info->hasTrigger)
+  {
+    info->preSampleRatio = ScpGetPreSampleRatio(scp);
+    info->triggerTimeOut = ScpGetTriggerTimeOut(scp);
+
+    info->hasTriggerDelay = ScpHasTriggerDelay(scp);
+    if(info->hasTriggerDelay)
+    {
+      info->triggerDelayMax = ScpGetTriggerDelayMax(scp);
+      info->triggerDelay = ScpGetTriggerDelay(scp);
+    }
+
+    info->hasTriggerHoldOff = ScpHasTriggerHoldOff(scp);
+    if(info->hasTriggerHoldOff)
+    {
+      info->triggerHoldOffCountMax = ScpGetTriggerHoldOffCountMax(scp);
+      info->triggerHoldOffCount = ScpGetTriggerHoldOffCount(scp);
+    }
+  }
+
+  info->channels = calloc(info->channelCount, sizeof(ChannelInfo_t));
+  for(uint16_t ch = 0; ch < info->channelCount; ch++)
+    getChannelInfo(scp, ch, &info->channels[ch]);
+}
+
+static void getGeneratorInfo(LibTiePieHandle_t gen, GeneratorInfo_t* info)
+{
+  info->connectorType = GenGetConnectorType(gen);
+  info->isDifferential = GenIsDifferential(gen);
+  info->isControllable = GenIsControllable(gen);
+  info->impedance = GenGetImpedance(gen);
+  info->resolution = GenGetResolution(gen);
+  info->outputValueMin = GenGetOutputValueMin(gen);
+  info->outputValueMax = GenGetOutputValueMax(gen);
+  info->outputOn = GenGetOutputOn(gen);
+  info->hasOutputInvert = GenHasOutputInvert(gen);
+  if(info->hasOutputInvert)
+    info->outputInvert = GenGetOutputInvert(gen);
+
+  info->modesNative = GenGetModesNative(gen);
+  info->modes = GenGetModes(gen);
+  if(info->modes != GMM_NONE)
+  {
+    info->mode = GenGetMode(gen);
+    if(info->mode & GMM_BURST_COUNT)
+    {
+      info->isBurstActive = GenIsBurstActive(gen);
+      info->burstCountMax = GenGetBurstCountMax(gen);
+      info->burstCount = GenGetBurstCount(gen);
+    }
+    if(info->mode & GMM_BURST_SAMPLE_COUNT)
+    {
+      info->burstSampleCountMax = GenGetBurstSampleCountMax(gen);
+      info->burstSampleCount = GenGetBurstSampleCount(gen);
+    }
+    if(info->mode & GMM_BURST_SEGMENT_COUNT)
+    {
+      info->burstSegmentCountMax = GenGetBurstSegmentCountMax(gen);
+      info->burstSegmentCount = GenGetBurstSegmentCount(gen);
+    }
+  }
+
+  info->signalTypes = GenGetSignalTypes(gen);
+  info->signalType = GenGetSignalType(gen);
+
+  info->hasAmplitude = GenHasAmplitude(gen);
+  if(info->hasAmplitude)
+  {
+    info->amplitudeMin = GenGetAmplitudeMin(gen);
+    info->amplitudeMax = GenGetAmplitudeMax(gen);
+    info->amplitude = GenGetAmplitude(gen);
+    info->amplitudeRangeCount = GenGetAmplitudeRanges(gen, NULL, 0);
+    info->amplitudeRanges = malloc(sizeof(double) * info->amplitudeRangeCount);
+    info->amplitudeRangeCount = GenGetAmplitudeRanges(gen, info->amplitudeRanges, info->amplitudeRangeCount);
+    info->amplitudeRange = GenGetAmplitudeRange(gen);
+    info->amplitudeAutoRanging = GenGetAmplitudeAutoRanging(gen);
+  }
+
+  info->hasFrequency = GenHasFrequency(gen);
+  if(info->hasFrequency)
+  {
+    info->frequencyModes = GenGetFrequencyModes(gen);
+    info->frequencyMode = GenGetFrequencyMode(gen);
+    info->frequencyMin = GenGetFrequencyMin(gen);
+    info->frequencyMax = GenGetFrequencyMax(gen);
+    info->frequency = GenGetFrequency(gen);
+  }
+
+  info->hasOffset = GenHasOffset(gen);
+  if(info->hasOffset)
+  {
+    info->offsetMin = GenGetOffsetMin(gen);
+    info->offsetMax = GenGetOffsetMax(gen);
+    info->offset = GenGetOffset(gen);
+  }
+
+  info->hasPhase = GenHasPhase(gen);
+  if(info->hasPhase)
+  {
+    info->phaseMin = GenGetPhaseMin(gen);
+    info->phaseMax = GenGetPhaseMax(gen);
+    info->phase = GenGetPhase(gen);
+  }
+
+  info->hasSymmetry = GenHasSymmetry(gen);
+  if(info->hasSymmetry)
+  {
+    info->symmetryMin = GenGetSymmetryMin(gen);
+    info->symmetryMax = GenGetSymmetryMax(gen);
+    info->symmetry = GenGetSymmetry(gen);
+  }
+
+  info->hasWidth = GenHasWidth(gen);
+  if(info->hasWidth)
+  {
+    info->widthMin = GenGetWidthMin(gen);
+    info->widthMax = GenGetWidthMax(gen);
+    info->width = GenGetWidth(gen);
+  }
+
+  info->hasEdgeTime = GenHasEdgeTime(gen);
+  if(info->hasEdgeTime)
+  {
+    info->leadingEdgeTimeMin = GenGetLeadingEdgeTimeMin(gen);
+    info->leadingEdgeTimeMax = GenGetLeadingEdgeTimeMax(gen);
+    info->leadingEdgeTime = GenGetLeadingEdgeTime(gen);
+    info->trailingEdgeTimeMin = GenGetTrailingEdgeTimeMin(gen);
+    info->trailingEdgeTimeMax = GenGetTrailingEdgeTimeMax(gen);
+    info->trailingEdgeTime = GenGetTrailingEdgeTime(gen);
+  }
+
+  info->hasData = GenHasData(gen);
+  if(info->hasData)
+  {
+    info->dataLengthMin = GenGetDataLengthMin(gen);
+    info->dataLengthMax = GenGetDataLengthMax(gen);
+    info->dataLength = GenGetDataLength(gen);
+  }
+}
+
+static void getI2CInfo(LibTiePieHandle_t i2c, I2CInfo_t* info)
+{
+  info->internalAddressCount = I2CGetInternalAddresses(i2c, NULL, 0);
+  info->internalAddresses = malloc(sizeof(uint16_t) * info->internalAddressCount);
+  info->internalAddressCount = I2CGetInternalAddresses(i2c, info->internalAddresses, info->internalAddressCount);
+  info->speedMax = I2CGetSpeedMax(i2c);
+  info->speed = I2CGetSpeed(i2c);
+}
+
+static void getBatteryInfo(LibTiePieHandle_t dev, BatteryInfo_t* info)
+{
+  info->charge = DevGetBatteryCharge(dev);
+  info->hasCharge = isSupported();
+  info->timeToEmpty = DevGetBatteryTimeToEmpty(dev);
+  info->hasTimeToEmpty = isSupported();
+  info->timeToFull = DevGetBatteryTimeToFull(dev);
+  info->hasTimeToFull = isSupported();
+  info->isChargerConnected = DevIsBatteryChargerConnected(dev);
+  info->hasChargerConnected = isSupported();
+  info->isCharging = DevIsBatteryCharging(dev);
+  info->hasCharging = isSupported();
+  info->isBroken = DevIsBatteryBroken(dev);
+  info->hasBroken = isSupported();
+}
+
+// Device type specific properties of info->type and trigger inputs/outputs:
+static void getTypeAndTriggerInfo(DeviceInfo_t* info)
+{
+  const LibTiePieHandle_t dev = info->handle;
+
+  // Trigger inputs/outputs in parallel with the device type specific properties:
+  pthread_t thread;
+  const bool8_t threaded = (pthread_create(&thread, NULL, getTriggerInputsOutputsInfo, info) == 0);
+  if(!threaded)
+    getTriggerInputsOutputsInfo(info);
+
+  switch(info->type)
+  {
+    case DEVICETYPE_OSCILLOSCOPE:
+      getOscilloscopeInfo(dev, &info->oscilloscope);
+      break;
+
+    case DEVICETYPE_GENERATOR:
+      getGeneratorInfo(dev, &info->generator);
+      break;
+
+    case DEVICETYPE_I2CHOST:
+      getI2CInfo(dev, &info->i2c);
+      break;
+  }
+
+  if(threaded)
+    pthread_join(thread, NULL);
+}
+
+DeviceInfo_t* getDeviceInfo(LibTiePieHandle_t dev)
+{
+  if(dev == LIBTIEPIE_HANDLE_INVALID)
+    return NULL;
+
+  DeviceInfo_t* info = calloc(1, sizeof(DeviceInfo_t));
+  info->handle = dev;
+
+  // Generic properties, these rely on LibGetLastStatus() and are gathered before any other thread uses the handle:
+  info->type = DevGetType(dev);
+  info->name = getString(DevGetName, dev);
+  info->nameShort = getString(DevGetNameShort, dev);
+  info->serialNumber = DevGetSerialNumber(dev);
+  info->calibrationDate = DevGetCalibrationDate(dev);
+  info->productId = DevGetProductId(dev);
+  info->vendorId = DevGetVendorId(dev);
+  info->driverVersion = DevGetDriverVersion(dev);
+  info->hasDriverVersion = isSupported();
+  info->firmwareVersion = DevGetFirmwareVersion(dev);
+  info->hasFirmwareVersion = isSupported();
+  info->ipv4Address = DevGetIPv4Address(dev);
+  info->hasIPv4Address = isSupported();
+  info->ipPort = DevGetIPPort(dev);
+  info->hasIPPort = isSupported();
+  info->hasBattery = DevHasBattery(dev);
+  if(info->hasBattery)
+    getBatteryInfo(dev, &info->battery);
+
+  getTypeAndTriggerInfo(info);
+
+  return info;
+}
+
+DeviceInfo_t* getDeviceTypeInfo(LibTiePieHandle_t dev, uint32_t type)
+{
+  if(dev == LIBTIEPIE_HANDLE_INVALID)
+    return NULL;
+
+  DeviceInfo_t* info = calloc(1, sizeof(DeviceInfo_t));
+  info->handle = dev;
+  info->type = type;
+
+  getTypeAndTriggerInfo(info);
+
+  return info;
+}
+
+DeviceInfo_t* getDeviceTriggerInfo(LibTiePieHandle_t dev)
+{
+  if(dev == LIBTIEPIE_HANDLE_INVALID)
+    return NULL;
+
+  DeviceInfo_t* info = calloc(1, sizeof(DeviceInfo_t));
+  info->handle = dev;
+
+  getTriggerInputsOutputsInfo(info);
+
+  return info;
+}
+
+void freeDeviceInfo(DeviceInfo_t* info)
+{
+  if(!info)
+    return;
+
+  for(uint16_t i = 0; i < info->triggerInputCount; i++)
+    free(info->triggerInputs[i].name);
+  free(info->triggerInputs);
+
+  for(uint16_t i = 0; i < info->triggerOutputCount; i++)
+    free(info->triggerOutputs[i].name);
+  free(info->triggerOutputs);
+
+  switch(info->type)
+  {
+    case DEVICETYPE_OSCILLOSCOPE:
+      for(uint16_t ch = 0; ch < info->oscilloscope.channelCount; ch++)
+      {
+        ChannelInfo_t* channel = &info->oscilloscope.channels[ch];
+        free(channel->bandwidths);
+        free(channel->ranges);
+        free(channel->trigger.levels);
+        free(channel->trigger.hystereses);
+        free(channel->trigger.times);
+      }
+      free(info->oscilloscope.channels);
+      free(info->oscilloscope.resolutions);
+      free(info->oscilloscope.clockOutputFrequencies);
+      free(info->oscilloscope.clockSourceFrequencies);
+      break;
+
+    case DEVICETYPE_GENERATOR:
+      free(info->generator.amplitudeRanges);
+      break;
+
+    case DEVICETYPE_I2CHOST:
+      free(info->i2c.internalAddresses);
+      break;
+  }
+
+  free(info->name);
+  free(info->nameShort);
+  free(info);
+}
+
+ServerInfo_t* getServerInfo(LibTiePieHandle_t srv)
+{
+  if(srv == LIBTIEPIE_HANDLE_INVALID)
+    return NULL;
+
+  ServerInfo_t* info = calloc(1, sizeof(ServerInfo_t));
+
+  info->url = getString(SrvGetURL, srv);
+  info->name = getString(SrvGetName, srv);
+  info->description = getString(SrvGetDescription, srv);
+  info->ipv4Address = SrvGetIPv4Address(srv);
+  info->ipPort = SrvGetIPPort(srv);
+  info->id = getString(SrvGetID, srv);
+  info->version = SrvGetVersion(srv);
+  info->status = SrvGetStatus(srv);
+  info->lastError = SrvGetLastError(srv);
+
+  return info;
+}
+
+void freeServerInfo(ServerInfo_t* info)
+{
+  if(info)
+  {
+    free(info->url);
+    free(info->name);
+    free(info->description);
+    free(info->id);
+    free(info);
+  }
+}
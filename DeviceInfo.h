@@ -0,0 +1,288 @@
+/**
+ * DeviceInfo.h
+ *
+ * This file is part of the LibTiePie programming examples.
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#ifndef _DEVICEINFO_H_
+#define _DEVICEINFO_H_
+
+#include <libtiepie.h>
+
+// Snapshots of all library, device and server properties.
+// A snapshot is gathered once with get*Info() and can be rendered any number of times without further device traffic.
+// Properties that are not supported by the device have their has* flag cleared.
+
+typedef struct
+{
+  TpVersion_t version;
+  const char* versionExtra;
+  uint32_t configLength;
+  uint8_t* config;
+} LibraryInfo_t;
+
+typedef struct
+{
+  uint32_t id;
+  char* name;
+  bool8_t isAvailable;
+  bool8_t isEnabled;
+  uint64_t kinds;
+  uint64_t kind;
+} TriggerInputInfo_t;
+
+typedef struct
+{
+  uint32_t id;
+  char* name;
+  bool8_t isEnabled;
+  uint64_t events;
+  uint64_t event;
+} TriggerOutputInfo_t;
+
+typedef struct
+{
+  bool8_t isAvailable;
+  bool8_t isEnabled;
+  uint64_t kinds;
+  uint64_t kind;
+  uint32_t levelModes;
+  uint32_t levelMode;
+  uint32_t levelCount;
+  double* levels;
+  uint32_t hysteresisCount;
+  double* hystereses;
+  uint32_t conditions;
+  uint32_t condition;
+  uint32_t timeCount;
+  double* times;
+} ChannelTriggerInfo_t;
+
+typedef struct
+{
+  uint32_t connectorType;
+  bool8_t isDifferential;
+  double impedance;
+  bool8_t hasConnectionTest;
+  bool8_t isAvailable;
+  bool8_t isEnabled;
+  uint32_t bandwidthCount;
+  double* bandwidths;
+  double bandwidth;
+  uint64_t couplings;
+  uint64_t coupling;
+  bool8_t autoRanging;
+  uint32_t rangeCount;
+  double* ranges;
+  double range;
+  double probeGain;
+  double probeOffset;
+  bool8_t hasSafeGround;
+  bool8_t safeGroundEnabled;
+  double safeGroundThresholdMin;
+  double safeGroundThresholdMax;
+  double safeGroundThreshold;
+  bool8_t hasTrigger;
+  ChannelTriggerInfo_t trigger;
+} ChannelInfo_t;
+
+typedef struct
+{
+  uint16_t channelCount;
+  bool8_t hasConnectionTest;
+  uint32_t measureModes;
+  uint32_t measureMode;
+  uint32_t autoResolutionModes;
+  uint32_t autoResolutionMode;
+  uint32_t resolutionCount;
+  uint8_t* resolutions;
+  uint8_t resolution;
+  bool8_t isResolutionEnhanced;
+  uint32_t clockOutputs;
+  uint32_t clockOutput;
+  uint32_t clockOutputFrequencyCount;
+  double* clockOutputFrequencies;
+  double clockOutputFrequency;
+  uint32_t clockSources;
+  uint32_t clockSource;
+  uint32_t clockSourceFrequencyCount;
+  double* clockSourceFrequencies;
+  double clockSourceFrequency;
+  uint64_t recordLengthMax;
+  uint64_t recordLength;
+  double sampleFrequencyMax;
+  double sampleFrequency;
+  uint32_t segmentCountMax;  // Block mode only.
+  uint32_t segmentCount;     // Block mode only.
+  bool8_t hasTrigger;
+  double preSampleRatio;
+  double triggerTimeOut;
+  bool8_t hasTriggerDelay;
+  double triggerDelayMax;
+  double triggerDelay;
+  bool8_t hasTriggerHoldOff;
+  uint64_t triggerHoldOffCountMax;
+  uint64_t triggerHoldOffCount;
+  ChannelInfo_t* channels;
+} OscilloscopeInfo_t;
+
+typedef struct
+{
+  uint32_t connectorType;
+  bool8_t isDifferential;
+  bool8_t isControllable;
+  double impedance;
+  uint8_t resolution;
+  double outputValueMin;
+  double outputValueMax;
+  bool8_t outputOn;
+  bool8_t hasOutputInvert;
+  bool8_t outputInvert;
+  uint64_t modesNative;
+  uint64_t modes;
+  uint64_t mode;
+  bool8_t isBurstActive;
+  uint64_t burstCountMax;
+  uint64_t burstCount;
+  uint64_t burstSampleCountMax;
+  uint64_t burstSampleCount;
+  uint64_t burstSegmentCountMax;
+  uint64_t burstSegmentCount;
+  uint32_t signalTypes;
+  uint32_t signalType;
+  bool8_t hasAmplitude;
+  double amplitudeMin;
+  double amplitudeMax;
+  double amplitude;
+  uint32_t amplitudeRangeCount;
+  double* amplitudeRanges;
+  double amplitudeRange;
+  bool8_t amplitudeAutoRanging;
+  bool8_t hasFrequency;
+  uint32_t frequencyModes;
+  uint32_t frequencyMode;
+  double frequencyMin;
+  double frequencyMax;
+  double frequency;
+  bool8_t hasOffset;
+  double offsetMin;
+  double offsetMax;
+  double offset;
+  bool8_t hasPhase;
+  double phaseMin;
+  double phaseMax;
+  double phase;
+  bool8_t hasSymmetry;
+  double symmetryMin;
+  double symmetryMax;
+  double symmetry;
+  bool8_t hasWidth;
+  double widthMin;
+  double widthMax;
+  double width;
+  bool8_t hasEdgeTime;
+  double leadingEdgeTimeMin;
+  double leadingEdgeTimeMax;
+  double leadingEdgeTime;
+  double trailingEdgeTimeMin;
+  double trailingEdgeTimeMax;
+  double trailingEdgeTime;
+  bool8_t hasData;
+  uint64_t dataLengthMin;
+  uint64_t dataLengthMax;
+  uint64_t dataLength;
+} GeneratorInfo_t;
+
+typedef struct
+{
+  uint32_t internalAddressCount;
+  uint16_t* internalAddresses;
+  double speedMax;
+  double speed;
+} I2CInfo_t;
+
+typedef struct
+{
+  bool8_t hasCharge;
+  int8_t charge;
+  bool8_t hasTimeToEmpty;
+  int32_t timeToEmpty;
+  bool8_t hasTimeToFull;
+  int32_t timeToFull;
+  bool8_t hasChargerConnected;
+  bool8_t isChargerConnected;
+  bool8_t hasCharging;
+  bool8_t isCharging;
+  bool8_t hasBroken;
+  bool8_t isBroken;
+} BatteryInfo_t;
+
+typedef struct
+{
+  LibTiePieHandle_t handle;
+  uint32_t type;
+  char* name;
+  char* nameShort;
+  uint32_t serialNumber;
+  TpDate_t calibrationDate;
+  uint32_t productId;
+  uint32_t vendorId;
+  bool8_t hasDriverVersion;
+  TpVersion_t driverVersion;
+  bool8_t hasFirmwareVersion;
+  TpVersion_t firmwareVersion;
+  bool8_t hasIPv4Address;
+  uint32_t ipv4Address;
+  bool8_t hasIPPort;
+  uint16_t ipPort;
+  bool8_t hasBattery;
+  BatteryInfo_t battery;
+  uint16_t triggerInputCount;
+  TriggerInputInfo_t* triggerInputs;
+  uint16_t triggerOutputCount;
+  TriggerOutputInfo_t* triggerOutputs;
+  union // Selected by type.
+  {
+    OscilloscopeInfo_t oscilloscope;
+    GeneratorInfo_t generator;
+    I2CInfo_t i2c;
+  };
+} DeviceInfo_t;
+
+typedef struct
+{
+  char* url;
+  char* name;
+  char* description;
+  uint32_t ipv4Address;
+  uint16_t ipPort;
+  char* id;
+  TpVersion_t version;
+  uint32_t status;
+  uint32_t lastError;
+} ServerInfo_t;
+
+// Gather library info:
+LibraryInfo_t* getLibraryInfo();
+void freeLibraryInfo(LibraryInfo_t* info);
+
+// Gather device info, trigger inputs/outputs are gathered in parallel with the device type specific properties.
+// Returns NULL for an invalid handle.
+DeviceInfo_t* getDeviceInfo(LibTiePieHandle_t dev);
+
+// Gather the properties of the given device type and the trigger inputs/outputs only, without the generic properties.
+// Returns NULL for an invalid handle:
+DeviceInfo_t* getDeviceTypeInfo(LibTiePieHandle_t dev, uint32_t type);
+
+// Gather the trigger inputs/outputs only, the other fields are left zero. Returns NULL for an invalid handle:
+DeviceInfo_t* getDeviceTriggerInfo(LibTiePieHandle_t dev);
+
+void freeDeviceInfo(DeviceInfo_t* info);
+
+// Gather server info, returns NULL for an invalid handle:
+ServerInfo_t* getServerInfo(LibTiePieHandle_t srv);
+void freeServerInfo(ServerInfo_t* info);
+
+#endif
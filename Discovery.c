@@ -0,0 +1,115 @@
+/**
+ * Discovery.c
+ *
+ * This file is part of the LibTiePie programming examples.
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#include "Discovery.h"
+#include <stdio.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include "CheckStatus.h"
+#include "PrintInfo.h"
+#include "Utils.h" // for NEWLINE
+
+static pthread_t discoveryThread;
+static bool8_t discoveryPending = BOOL8_FALSE;
+static uint8_t discoveryDone = 0; // Set by the discovery thread when the search completes.
+
+static void discoverAllDevices()
+{
+  // Enable network search:
+  NetSetAutoDetectEnabled(BOOL8_TRUE);
+  CHECK_LAST_STATUS();
+
+  // Update device list:
+  LstUpdate();
+  CHECK_LAST_STATUS();
+}
+
+// Background search. The last status is shared with the main thread, so it isn't checked here, a check would report
+// the status of a main thread call or report ours there:
+static void* discoverNetworkDevices(void* arg)
+{
+  // Enable network search:
+  NetSetAutoDetectEnabled(BOOL8_TRUE);
+
+  // Update device list, new devices are reported through the device added callback:
+  LstUpdate();
+
+  __atomic_store_n(&discoveryDone, 1, __ATOMIC_RELEASE);
+
+  return NULL;
+}
+
+void startDiscovery(int mode, TpCallbackDeviceList_t callback, void* data)
+{
+  if(mode == DISCOVERY_LOCAL_FIRST)
+  {
+    // Disable network search, so LstUpdate() doesn't wait for network devices:
+    NetSetAutoDetectEnabled(BOOL8_FALSE);
+    CHECK_LAST_STATUS();
+
+    // Update device list with local devices:
+    LstUpdate();
+    CHECK_LAST_STATUS();
+
+    // Report devices found from now on:
+    if(callback)
+    {
+      LstSetCallbackDeviceAdded(callback, data);
+      CHECK_LAST_STATUS();
+    }
+
+    // Search network devices in the background:
+    if(pthread_create(&discoveryThread, NULL, discoverNetworkDevices, NULL) == 0)
+    {
+      discoveryPending = BOOL8_TRUE;
+    }
+    else
+    {
+      fprintf(stderr, "Couldn't start network discovery thread, searching in the foreground." NEWLINE);
+      discoverAllDevices();
+    }
+  }
+  else
+  {
+    discoverAllDevices();
+  }
+}
+
+bool8_t waitForDiscovery()
+{
+  if(!discoveryPending)
+    return BOOL8_FALSE;
+
+  pthread_join(discoveryThread, NULL);
+  discoveryPending = BOOL8_FALSE;
+
+  return BOOL8_TRUE;
+}
+
+void stopDiscovery()
+{
+  LstSetCallbackDeviceAdded(NULL, NULL);
+
+  if(discoveryPending)
+  {
+    // Don't wait for a search that is still running, it would delay the exit by the network time out:
+    if(__atomic_load_n(&discoveryDone, __ATOMIC_ACQUIRE))
+      pthread_join(discoveryThread, NULL);
+    else
+      pthread_detach(discoveryThread);
+
+    discoveryPending = BOOL8_FALSE;
+  }
+}
+
+void printDiscoveredDevice(void* data, uint32_t deviceTypes, uint32_t serialNumber)
+{
+  printf("Found device, s/n: %" PRIu32 ", types: ", serialNumber);
+  printDeviceType(deviceTypes);
+  printf(NEWLINE);
+}
@@ -0,0 +1,31 @@
+/**
+ * Discovery.h
+ *
+ * This file is part of the LibTiePie programming examples.
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#ifndef _DISCOVERY_H_
+#define _DISCOVERY_H_
+
+#include <libtiepie.h>
+
+// Discovery modes:
+#define DISCOVERY_BLOCKING    0 // Search local and network devices, return when done.
+#define DISCOVERY_LOCAL_FIRST 1 // Search local devices, search network devices in the background.
+
+// Update the device list, devices found in the background are reported to callback (may be NULL):
+void startDiscovery(int mode, TpCallbackDeviceList_t callback, void* data);
+
+// Wait for the background network search to complete.
+// Returns BOOL8_TRUE if a search was pending, the device list may have new entries then.
+bool8_t waitForDiscovery();
+
+// Unregister the callback, call before LibExit(). A background network search that is still running isn't waited for:
+void stopDiscovery();
+
+// Callback printing devices found in the background:
+void printDiscoveredDevice(void* data, uint32_t deviceTypes, uint32_t serialNumber);
+
+#endif
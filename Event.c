@@ -0,0 +1,104 @@
+/**
+ * Event.c
+ *
+ * This file is part of the LibTiePie programming examples.
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#include "Event.h"
+#include <time.h>
+#include "Utils.h"
+
+void eventInit(Event_t* event)
+{
+  pthread_condattr_t attributes;
+
+  pthread_condattr_init(&attributes);
+#ifndef OS_WINDOWS
+  // Time outs on the monotonic clock, not affected by clock changes:
+  pthread_condattr_setclock(&attributes, CLOCK_MONOTONIC);
+#endif
+
+  pthread_mutex_init(&event->lock, NULL);
+  pthread_cond_init(&event->set, &attributes);
+  pthread_condattr_destroy(&attributes);
+  event->count = 0;
+  event->time = 0;
+}
+
+void eventFree(Event_t* event)
+{
+  pthread_cond_destroy(&event->set);
+  pthread_mutex_destroy(&event->lock);
+}
+
+void eventSet(Event_t* event)
+{
+  const uint64_t time = getTimeNanoSeconds();
+
+  pthread_mutex_lock(&event->lock);
+  event->count++;
+  event->time = time;
+  pthread_cond_signal(&event->set);
+  pthread_mutex_unlock(&event->lock);
+}
+
+void eventCallback(void* data)
+{
+  eventSet((Event_t*)data);
+}
+
+void eventReset(Event_t* event)
+{
+  pthread_mutex_lock(&event->lock);
+  event->count = 0;
+  pthread_mutex_unlock(&event->lock);
+}
+
+bool8_t eventWait(Event_t* event, unsigned int timeout, uint64_t* time)
+{
+  struct timespec deadline;
+  int result = 0;
+
+#ifdef OS_WINDOWS
+  clock_gettime(CLOCK_REALTIME, &deadline);
+#else // POSIX
+  clock_gettime(CLOCK_MONOTONIC, &deadline);
+#endif
+  deadline.tv_sec += timeout / 1000;
+  deadline.tv_nsec += (timeout % 1000) * 1000000L;
+  if(deadline.tv_nsec >= 1000000000L)
+  {
+    deadline.tv_sec++;
+    deadline.tv_nsec -= 1000000000L;
+  }
+
+  pthread_mutex_lock(&event->lock);
+
+  while(event->count == 0 && result == 0)
+    result = pthread_cond_timedwait(&event->set, &event->lock, &deadline);
+
+  const bool8_t isSet = event->count > 0;
+  if(isSet)
+  {
+    event->count--;
+    if(time)
+      *time = event->time;
+  }
+
+  pthread_mutex_unlock(&event->lock);
+
+  return isSet;
+}
+
+void eventWaitForData(Event_t* event, LibTiePieHandle_t scp)
+{
+  while(!(ScpIsDataReady(scp) || ScpIsDataOverflow(scp) || ObjIsRemoved(scp)))
+  {
+    eventWait(event, 100, NULL);
+  }
+
+  // Don't let callbacks of data that is ready now end the next wait:
+  eventReset(event);
+}
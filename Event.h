@@ -0,0 +1,42 @@
+/**
+ * Event.h
+ *
+ * This file is part of the LibTiePie programming examples.
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#ifndef _EVENT_H_
+#define _EVENT_H_
+
+#include <pthread.h>
+#include <libtiepie.h>
+
+// Event to wait for LibTiePie callbacks without polling.
+// Pass eventCallback() with the event as data to a LibTiePie callback setter, e.g. GenSetCallbackBurstCompleted().
+// Each set is consumed by one eventWait(), sets that aren't waited for yet are counted.
+
+typedef struct
+{
+  pthread_mutex_t lock;
+  pthread_cond_t set;
+  uint32_t count;
+  uint64_t time; // getTimeNanoSeconds() of the last set.
+} Event_t;
+
+void eventInit(Event_t* event);
+void eventFree(Event_t* event);
+void eventSet(Event_t* event);
+void eventCallback(void* data);
+
+// Forget sets that aren't waited for:
+void eventReset(Event_t* event);
+
+// Wait for a set, at most timeout ms. Returns BOOL8_FALSE on timeout, time is the time of the set, it may be NULL:
+bool8_t eventWait(Event_t* event, unsigned int timeout, uint64_t* time);
+
+// Wait until the oscilloscope has stream data, a data overflow or is removed, woken up by eventCallback() set as its
+// data ready and data overflow callback. Sets up to then are dropped, they are for the data the caller gets next:
+void eventWaitForData(Event_t* event, LibTiePieHandle_t scp);
+
+#endif
@@ -3,7 +3,7 @@ CONFIG += console
 CONFIG -= app_bundle
 CONFIG -= qt
 
-LIBS += -ltiepie
+LIBS += -ltiepie -lpthread
 
 win32 {
   msvc*:error("The Microsoft Visual C++ Compiler is not supported, please use MinGW.")
@@ -14,17 +14,21 @@ win32 {
 }
 
 unix {
-  QMAKE_CFLAGS += -std=gnu99
+  QMAKE_CFLAGS += -std=gnu99 -pthread
   LIBS += -lm
 }
 
 HEADERS += CheckStatus.h \
+           DeviceInfo.h \
+           Discovery.h \
            PrintInfo.h \
            Utils.h
 
 
 SOURCES += Generator.c \
            CheckStatus.c \
+           DeviceInfo.c \
+           Discovery.c \
            PrintInfo.c \
            Utils.c
 
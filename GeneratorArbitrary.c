@@ -8,11 +8,13 @@
 
 #include <stdlib.h>
 #include <stdio.h>
-#include <math.h>
+#include <inttypes.h>
 #include <libtiepie.h>
 #include "CheckStatus.h"
+#include "Discovery.h"
 #include "PrintInfo.h"
 #include "Utils.h"
+#include "WaveformSynth.h"
 
 int main(int argc, char* argv[])
 {
@@ -24,35 +26,37 @@ int main(int argc, char* argv[])
   // Print library information:
   printLibraryInfo();
 
-  // Enable network search:
-  NetSetAutoDetectEnabled(BOOL8_TRUE);
-  CHECK_LAST_STATUS();
-
-  // Update device list:
-  LstUpdate();
-  CHECK_LAST_STATUS();
+  // Update device list, search local devices first and network devices in the background:
+  startDiscovery(DISCOVERY_LOCAL_FIRST, printDiscoveredDevice, NULL);
 
   // Try to open a generator with arbitrary suppport:
   LibTiePieHandle_t gen = LIBTIEPIE_HANDLE_INVALID;
 
-  for(uint32_t index = 0; index < LstGetCount(); index++)
+  do
   {
-    if(LstDevCanOpen(IDKIND_INDEX, index, DEVICETYPE_GENERATOR))
+    for(uint32_t index = 0; index < LstGetCount(); index++)
     {
-      gen = LstOpenGenerator(IDKIND_INDEX, index);
-      CHECK_LAST_STATUS();
+      // Open by serial number, indices change when network devices are added in the background:
+      const uint32_t serialNumber = LstDevGetSerialNumber(IDKIND_INDEX, index);
 
-      // Check for valid handle and arbitrary support:
-      if(gen != LIBTIEPIE_HANDLE_INVALID && (GenGetSignalTypes(gen) & ST_ARBITRARY))
-      {
-        break;
-      }
-      else
+      if(LstDevCanOpen(IDKIND_SERIALNUMBER, serialNumber, DEVICETYPE_GENERATOR))
       {
-        gen = LIBTIEPIE_HANDLE_INVALID;
+        gen = LstOpenGenerator(IDKIND_SERIALNUMBER, serialNumber);
+        CHECK_LAST_STATUS();
+
+        // Check for valid handle and arbitrary support:
+        if(gen != LIBTIEPIE_HANDLE_INVALID && (GenGetSignalTypes(gen) & ST_ARBITRARY))
+        {
+          break;
+        }
+        else
+        {
+          gen = LIBTIEPIE_HANDLE_INVALID;
+        }
       }
     }
   }
+  while(gen == LIBTIEPIE_HANDLE_INVALID && waitForDiscovery()); // Not found, retry when network search completes.
 
   if(gen != LIBTIEPIE_HANDLE_INVALID)
   {
@@ -80,16 +84,29 @@ int main(int argc, char* argv[])
     GenSetOutputOn(gen, BOOL8_TRUE);
     CHECK_LAST_STATUS();
 
-    // Create signal array:
-    float data[8192];
-    for(unsigned int i = 0; i < 8192; i++)
+    // Create signal array, of the maximum length the generator supports:
+    uint64_t length;
+    float* data = createWaveformBuffer(gen, &length);
+    if(data)
     {
-      data[i] = sinf((float)(i / 100)) * (1 - ((float)(i / 8192)));
-    }
+      // Damped sine, 100 periods with a time constant of 1/5 of the signal length:
+      const double sampleFrequency = GenGetFrequency(gen);
+      const uint64_t start = getTimeNanoSeconds();
+      synthDampedSine(data, length, sampleFrequency, 100 * sampleFrequency / length, length / sampleFrequency / 5, 1);
+      printf("Generated %" PRIu64 " samples in %.1f ms" NEWLINE, length, (getTimeNanoSeconds() - start) / 1e6);
+
+      // Load the signal array into the generator:
+      GenSetData(gen, data, length);
+      CHECK_LAST_STATUS();
 
-    // Load the signal array into the generator:
-    GenSetData(gen, data, 8192);
-    CHECK_LAST_STATUS();
+      // Free signal array:
+      free(data);
+    }
+    else
+    {
+      fprintf(stderr, "Couldn't allocate signal array!" NEWLINE);
+      status = EXIT_FAILURE;
+    }
 
     // Print generator info:
     printDeviceInfo(gen);
@@ -120,6 +137,9 @@ int main(int argc, char* argv[])
     status = EXIT_FAILURE;
   }
 
+  // Stop device discovery:
+  stopDiscovery();
+
   // Exit library:
   LibExit();
 
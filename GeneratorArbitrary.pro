@@ -3,7 +3,7 @@ CONFIG += console
 CONFIG -= app_bundle
 CONFIG -= qt
 
-LIBS += -ltiepie
+LIBS += -ltiepie -lpthread
 
 win32 {
   msvc*:error("The Microsoft Visual C++ Compiler is not supported, please use MinGW.")
@@ -14,19 +14,27 @@ win32 {
 }
 
 unix {
-  QMAKE_CFLAGS += -std=gnu99
+  QMAKE_CFLAGS += -std=gnu99 -pthread
   LIBS += -lm
 }
 
 HEADERS += CheckStatus.h \
+           DeviceInfo.h \
+           Discovery.h \
+           Parallel.h \
            PrintInfo.h \
-           Utils.h
+           Utils.h \
+           WaveformSynth.h
 
 
 SOURCES += GeneratorArbitrary.c \
            CheckStatus.c \
+           DeviceInfo.c \
+           Discovery.c \
+           Parallel.c \
            PrintInfo.c \
-           Utils.c
+           Utils.c \
+           WaveformSynth.c
 
 # Copy files to build directory:
 for(FILE,COPY_FILE_TO_BUILD_DIRECTORY) {
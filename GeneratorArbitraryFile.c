@@ -0,0 +1,177 @@
+/**
+ * GeneratorArbitraryFile.c
+ *
+ * This example generates an arbitrary waveform loaded from a raw float32 or int16 file.
+ * Usage: GeneratorArbitraryFile <file> [float32|int16]
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <inttypes.h>
+#include <libtiepie.h>
+#include "CheckStatus.h"
+#include "Discovery.h"
+#include "PrintInfo.h"
+#include "Resample.h"
+#include <string.h>
+#include "Utils.h"
+#include "WaveformFile.h"
+
+int main(int argc, char* argv[])
+{
+  int status = EXIT_SUCCESS;
+
+  // Check arguments:
+  if(argc < 2 || (argc > 2 && strcmp(argv[2], "float32") != 0 && strcmp(argv[2], "int16") != 0))
+  {
+    fprintf(stderr, "Usage: %s <file> [float32|int16]" NEWLINE, argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  // Load waveform, int16 samples are converted to floats:
+  WaveformFile_t waveform;
+  uint64_t start = getTimeNanoSeconds();
+  if(!openWaveformFile(&waveform, argv[1], argc > 2 && strcmp(argv[2], "int16") == 0 ? WAVEFORM_INT16 : WAVEFORM_FLOAT32))
+  {
+    return EXIT_FAILURE;
+  }
+  printf("Loaded %" PRIu64 " samples in %.1f ms" NEWLINE, waveform.length, (getTimeNanoSeconds() - start) / 1e6);
+
+  // Initialize library:
+  LibInit();
+
+  // Print library information:
+  printLibraryInfo();
+
+  // Update device list, search local devices first and network devices in the background:
+  startDiscovery(DISCOVERY_LOCAL_FIRST, printDiscoveredDevice, NULL);
+
+  // Try to open a generator with arbitrary suppport:
+  LibTiePieHandle_t gen = LIBTIEPIE_HANDLE_INVALID;
+
+  do
+  {
+    for(uint32_t index = 0; index < LstGetCount(); index++)
+    {
+      // Open by serial number, indices change when network devices are added in the background:
+      const uint32_t serialNumber = LstDevGetSerialNumber(IDKIND_INDEX, index);
+
+      if(LstDevCanOpen(IDKIND_SERIALNUMBER, serialNumber, DEVICETYPE_GENERATOR))
+      {
+        gen = LstOpenGenerator(IDKIND_SERIALNUMBER, serialNumber);
+        CHECK_LAST_STATUS();
+
+        // Check for valid handle and arbitrary support:
+        if(gen != LIBTIEPIE_HANDLE_INVALID && (GenGetSignalTypes(gen) & ST_ARBITRARY))
+        {
+          break;
+        }
+        else
+        {
+          gen = LIBTIEPIE_HANDLE_INVALID;
+        }
+      }
+    }
+  }
+  while(gen == LIBTIEPIE_HANDLE_INVALID && waitForDiscovery()); // Not found, retry when network search completes.
+
+  if(gen != LIBTIEPIE_HANDLE_INVALID)
+  {
+    // Set signal type:
+    GenSetSignalType(gen, ST_ARBITRARY);
+    CHECK_LAST_STATUS();
+
+    // Select frequency mode:
+    GenSetFrequencyMode(gen, FM_SAMPLEFREQUENCY);
+    CHECK_LAST_STATUS();
+
+    // Set frequency:
+    GenSetFrequency(gen, 100e3); // 100 kHz
+    CHECK_LAST_STATUS();
+
+    // Set amplitude:
+    GenSetAmplitude(gen, 2); // 2 V
+    CHECK_LAST_STATUS();
+
+    // Set offset:
+    GenSetOffset(gen, 0); // 0 V
+    CHECK_LAST_STATUS();
+
+    // Enable output:
+    GenSetOutputOn(gen, BOOL8_TRUE);
+    CHECK_LAST_STATUS();
+
+    // Load the waveform into the generator, resample if the length isn't supported:
+    const uint64_t length = getResampleLength(gen, waveform.length, 0, 0);
+    if(length == waveform.length)
+    {
+      start = getTimeNanoSeconds();
+      GenSetData(gen, waveform.data, waveform.length);
+      CHECK_LAST_STATUS();
+      printf("Uploaded in %.1f ms" NEWLINE, (getTimeNanoSeconds() - start) / 1e6);
+    }
+    else
+    {
+      float* data = malloc(sizeof(float) * length);
+      start = getTimeNanoSeconds();
+      if(data && resample(waveform.data, waveform.length, data, length))
+      {
+        printf("Resampled to %" PRIu64 " samples in %.1f ms" NEWLINE, length, (getTimeNanoSeconds() - start) / 1e6);
+
+        // Keep the waveform duration:
+        GenSetFrequency(gen, GenGetFrequency(gen) * length / waveform.length);
+        CHECK_LAST_STATUS();
+
+        GenSetData(gen, data, length);
+        CHECK_LAST_STATUS();
+      }
+      else
+      {
+        fprintf(stderr, "Failed to resample to %" PRIu64 " samples!" NEWLINE, length);
+        status = EXIT_FAILURE;
+      }
+      free(data);
+    }
+
+    // Print generator info:
+    printDeviceInfo(gen);
+
+    // Start signal generation:
+    GenStart(gen);
+    CHECK_LAST_STATUS();
+
+    // Wait for keystroke:
+    printf("Press any key to stop signal generation..." NEWLINE);
+    waitForKeyStroke();
+
+    // Stop generator:
+    GenStop(gen);
+    CHECK_LAST_STATUS();
+
+    // Disable output:
+    GenSetOutputOn(gen, BOOL8_FALSE);
+    CHECK_LAST_STATUS();
+
+    // Close generator:
+    ObjClose(gen);
+    CHECK_LAST_STATUS();
+  }
+  else
+  {
+    fprintf(stderr, "No generator available with arbitrary support!" NEWLINE);
+    status = EXIT_FAILURE;
+  }
+
+  // Stop device discovery:
+  stopDiscovery();
+
+  // Exit library:
+  LibExit();
+
+  // Close waveform file:
+  closeWaveformFile(&waveform);
+
+  return status;
+}
@@ -0,0 +1,356 @@
+/**
+ * GeneratorBurstSequence.c
+ *
+ * This example generates a sequence of bursts with different burst counts and frequencies, with minimal gaps between them.
+ * The next burst is prepared while the current one runs, completion is signaled by the burst completed callback.
+ * The gap from the completion of a burst to the start of the next one is written to GeneratorBurstSequence.csv.
+ * Usage: GeneratorBurstSequence [file], with one burst per line: count frequency [amplitude]
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <inttypes.h>
+#include <libtiepie.h>
+#include "CheckStatus.h"
+#include "Discovery.h"
+#include "Event.h"
+#include "Latency.h"
+#include "PrintInfo.h"
+#include "Utils.h"
+
+#define DEFAULT_STEP_COUNT 20
+
+typedef struct
+{
+  uint64_t count; // Periods.
+  double frequency; // Hz
+  double amplitude; // V
+} BurstStep_t;
+
+// Load steps from file, or create the default sequence. Returns the number of steps, 0 on error:
+static uint32_t loadSteps(const char* filename, BurstStep_t** steps)
+{
+  uint32_t count = 0;
+
+  if(!filename)
+  {
+    *steps = malloc(sizeof(BurstStep_t) * DEFAULT_STEP_COUNT);
+    if(!*steps)
+      return 0;
+
+    for(count = 0; count < DEFAULT_STEP_COUNT; count++)
+    {
+      (*steps)[count].count = 10 + 10 * (count % 5); // 10..50 periods
+      (*steps)[count].frequency = 1e3 * (1 + count % 4); // 1..4 kHz
+      (*steps)[count].amplitude = 2; // 2 V
+    }
+
+    return count;
+  }
+
+  FILE* file = fopen(filename, "r");
+  if(!file)
+  {
+    fprintf(stderr, "Couldn't open file: %s" NEWLINE, filename);
+    return 0;
+  }
+
+  BurstStep_t step = {0, 0, 2};
+  uint32_t capacity = 0;
+  unsigned int lineNumber = 0;
+  char line[256];
+
+  *steps = NULL;
+
+  while(fgets(line, sizeof(line), file))
+  {
+    char first;
+
+    lineNumber++;
+
+    // Skip empty lines and comments:
+    if(sscanf(line, " %c", &first) != 1 || first == '#')
+      continue;
+
+    if(sscanf(line, "%" SCNu64 " %lf %lf", &step.count, &step.frequency, &step.amplitude) < 2 || step.count == 0 || step.frequency <= 0)
+    {
+      fprintf(stderr, "%s:%u Expected count frequency [amplitude]" NEWLINE, filename, lineNumber);
+      count = 0;
+      break;
+    }
+
+    if(count == capacity)
+    {
+      capacity = capacity ? capacity * 2 : 256;
+      BurstStep_t* newSteps = realloc(*steps, sizeof(BurstStep_t) * capacity);
+      if(!newSteps)
+      {
+        count = 0;
+        break;
+      }
+      *steps = newSteps;
+    }
+
+    (*steps)[count++] = step;
+  }
+
+  fclose(file);
+
+  if(count == 0)
+  {
+    free(*steps);
+    *steps = NULL;
+  }
+
+  return count;
+}
+
+int main(int argc, char* argv[])
+{
+  int status = EXIT_SUCCESS;
+
+  // Load burst sequence:
+  BurstStep_t* steps;
+  const uint32_t stepCount = loadSteps(argc > 1 ? argv[1] : NULL, &steps);
+  if(stepCount == 0)
+  {
+    fprintf(stderr, "Usage: %s [file], with one burst per line: count frequency [amplitude]" NEWLINE, argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  // Initialize library:
+  LibInit();
+
+  // Print library information:
+  printLibraryInfo();
+
+  // Update device list, search local devices first and network devices in the background:
+  startDiscovery(DISCOVERY_LOCAL_FIRST, printDiscoveredDevice, NULL);
+
+  // Try to open a generator with burst support:
+  LibTiePieHandle_t gen = LIBTIEPIE_HANDLE_INVALID;
+
+  do
+  {
+    for(uint32_t index = 0; index < LstGetCount(); index++)
+    {
+      // Open by serial number, indices change when network devices are added in the background:
+      const uint32_t serialNumber = LstDevGetSerialNumber(IDKIND_INDEX, index);
+
+      if(LstDevCanOpen(IDKIND_SERIALNUMBER, serialNumber, DEVICETYPE_GENERATOR))
+      {
+        gen = LstOpenGenerator(IDKIND_SERIALNUMBER, serialNumber);
+        CHECK_LAST_STATUS();
+
+        // Check for valid handle and burst support:
+        if(gen != LIBTIEPIE_HANDLE_INVALID && (GenGetModesNative(gen) & GM_BURST_COUNT))
+        {
+          break;
+        }
+        else
+        {
+          gen = LIBTIEPIE_HANDLE_INVALID;
+        }
+      }
+    }
+  }
+  while(gen == LIBTIEPIE_HANDLE_INVALID && waitForDiscovery()); // Not found, retry when network search completes.
+
+  if(gen != LIBTIEPIE_HANDLE_INVALID)
+  {
+    Event_t burstCompleted;
+    Latency_t gaps;
+    uint64_t* stepGaps = calloc(stepCount, sizeof(uint64_t));
+    uint32_t timeOutCount = 0;
+
+    eventInit(&burstCompleted);
+    latencyInit(&gaps);
+
+    // Set signal type:
+    GenSetSignalType(gen, ST_SINE);
+    CHECK_LAST_STATUS();
+
+    // Set offset:
+    GenSetOffset(gen, 0); // 0 V
+    CHECK_LAST_STATUS();
+
+    // Set mode:
+    GenSetMode(gen, GM_BURST_COUNT);
+    CHECK_LAST_STATUS();
+
+    // Get limits, to prepare steps without device calls:
+    const double frequencyMin = GenGetFrequencyMin(gen);
+    const double frequencyMax = GenGetFrequencyMax(gen);
+    const uint64_t burstCountMin = GenGetBurstCountMin(gen);
+    const uint64_t burstCountMax = GenGetBurstCountMax(gen);
+
+    // Signal burst completion:
+    GenSetCallbackBurstCompleted(gen, eventCallback, &burstCompleted);
+    CHECK_LAST_STATUS();
+
+    // Enable output:
+    GenSetOutputOn(gen, BOOL8_TRUE);
+    CHECK_LAST_STATUS();
+
+    // Print Generator info:
+    printDeviceInfo(gen);
+
+    printf("Running %" PRIu32 " bursts..." NEWLINE, stepCount);
+
+    BurstStep_t current = {0, 0, 0}; // Settings in the generator, 0 is unknown.
+    uint64_t completed = 0;
+    const uint64_t start = getTimeNanoSeconds();
+
+    for(uint32_t i = 0; i < stepCount && status == EXIT_SUCCESS; i++)
+    {
+      BurstStep_t next = steps[i];
+
+      // Prepare the next burst while the current one runs, limited to what the generator supports:
+      if(next.frequency < frequencyMin)
+        next.frequency = frequencyMin;
+      else if(next.frequency > frequencyMax)
+        next.frequency = frequencyMax;
+      if(next.count < burstCountMin)
+        next.count = burstCountMin;
+      else if(next.count > burstCountMax)
+        next.count = burstCountMax;
+
+      // Wait for the current burst to complete, at most twice its duration + 1 s:
+      if(i > 0)
+      {
+        if(!eventWait(&burstCompleted, (unsigned int)(current.count / current.frequency * 2000) + 1000, &completed))
+        {
+          // Missed callback, fall back to polling:
+          timeOutCount++;
+          while(GenIsBurstActive(gen) && !ObjIsRemoved(gen))
+          {
+            sleepMiliSeconds(1); // 1 ms delay, to save CPU time.
+          }
+          completed = getTimeNanoSeconds();
+        }
+
+        if(ObjIsRemoved(gen))
+        {
+          fprintf(stderr, "Device gone!" NEWLINE);
+          status = EXIT_FAILURE;
+          break;
+        }
+      }
+
+      // Only change what differs from the current burst:
+      if(next.frequency != current.frequency)
+      {
+        GenSetFrequency(gen, next.frequency);
+        CHECK_LAST_STATUS_FAST();
+      }
+
+      if(next.amplitude != current.amplitude)
+      {
+        GenSetAmplitude(gen, next.amplitude);
+        CHECK_LAST_STATUS_FAST();
+      }
+
+      if(next.count != current.count)
+      {
+        GenSetBurstCount(gen, next.count);
+        CHECK_LAST_STATUS_FAST();
+      }
+
+      current = next;
+
+      // Drop completions of earlier bursts, e.g. a callback arriving after the polling fallback, only the burst started here may end the next wait:
+      eventReset(&burstCompleted);
+
+      // Start burst:
+      GenStart(gen);
+      CHECK_LAST_STATUS_FAST();
+
+      if(i > 0)
+      {
+        stepGaps[i] = getTimeNanoSeconds() - completed;
+        latencyAdd(&gaps, stepGaps[i]);
+      }
+    }
+
+    // Wait for the last burst to complete:
+    if(status == EXIT_SUCCESS && !eventWait(&burstCompleted, (unsigned int)(current.count / current.frequency * 2000) + 1000, NULL))
+    {
+      timeOutCount++;
+      while(GenIsBurstActive(gen) && !ObjIsRemoved(gen))
+      {
+        sleepMiliSeconds(1); // 1 ms delay, to save CPU time.
+      }
+    }
+
+    const double seconds = (getTimeNanoSeconds() - start) / 1e9;
+
+    // Stop generator:
+    GenStop(gen);
+    CHECK_LAST_STATUS();
+
+    // Disable output:
+    GenSetOutputOn(gen, BOOL8_FALSE);
+    CHECK_LAST_STATUS();
+
+    GenSetCallbackBurstCompleted(gen, NULL, NULL);
+    CHECK_LAST_STATUS();
+
+    // Print results:
+    printf("Sequence done in %.3f s" NEWLINE, seconds);
+    if(timeOutCount > 0)
+      printf("Burst completed callback missed %" PRIu32 " time(s), polled instead" NEWLINE, timeOutCount);
+    printLatencyHeader();
+    printLatency("Gap between bursts", &gaps);
+
+    // Open file with write/update permissions:
+    const char* filename = "GeneratorBurstSequence.csv";
+    FILE* csv = fopen(filename, "w");
+    if(csv)
+    {
+      // Write csv header:
+      fprintf(csv, "Step;Count;Frequency;Amplitude;Gap (us)" NEWLINE);
+
+      // Write the gaps to csv, the first burst has no gap:
+      for(uint32_t i = 0; i < stepCount; i++)
+      {
+        fprintf(csv, "%" PRIu32 ";%" PRIu64 ";%f;%f;%f" NEWLINE, i + 1, steps[i].count, steps[i].frequency, steps[i].amplitude, stepGaps[i] / 1e3);
+      }
+
+      printf("Data written to: %s" NEWLINE, filename);
+
+      // Close file:
+      fclose(csv);
+    }
+    else
+    {
+      fprintf(stderr, "Couldn't open file: %s" NEWLINE, filename);
+      status = EXIT_FAILURE;
+    }
+
+    latencyFree(&gaps);
+    free(stepGaps);
+
+    // Close generator:
+    ObjClose(gen);
+    CHECK_LAST_STATUS();
+
+    eventFree(&burstCompleted);
+  }
+  else
+  {
+    fprintf(stderr, "No generator available with burst support!" NEWLINE);
+    status = EXIT_FAILURE;
+  }
+
+  // Stop device discovery:
+  stopDiscovery();
+
+  // Exit library:
+  LibExit();
+
+  free(steps);
+
+  return status;
+}
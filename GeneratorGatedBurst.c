@@ -10,6 +10,7 @@
 #include <stdio.h>
 #include <libtiepie.h>
 #include "CheckStatus.h"
+#include "Discovery.h"
 #include "PrintInfo.h"
 #include "Utils.h"
 
@@ -23,35 +24,37 @@ int main(int argc, char* argv[])
   // Print library information:
   printLibraryInfo();
 
-  // Enable network search:
-  NetSetAutoDetectEnabled(BOOL8_TRUE);
-  CHECK_LAST_STATUS();
-
-  // Update device list:
-  LstUpdate();
-  CHECK_LAST_STATUS();
+  // Update device list, search local devices first and network devices in the background:
+  startDiscovery(DISCOVERY_LOCAL_FIRST, printDiscoveredDevice, NULL);
 
   // Try to open a generator with gated burst support:
   LibTiePieHandle_t gen = LIBTIEPIE_HANDLE_INVALID;
 
-  for(uint32_t index = 0; index < LstGetCount(); index++)
+  do
   {
-    if(LstDevCanOpen(IDKIND_INDEX, index, DEVICETYPE_GENERATOR))
+    for(uint32_t index = 0; index < LstGetCount(); index++)
     {
-      gen = LstOpenGenerator(IDKIND_INDEX, index);
-      CHECK_LAST_STATUS();
+      // Open by serial number, indices change when network devices are added in the background:
+      const uint32_t serialNumber = LstDevGetSerialNumber(IDKIND_INDEX, index);
 
-      // Check for valid handle and arbitrary support:
-      if(gen != LIBTIEPIE_HANDLE_INVALID && (GenGetModesNative(gen) & GM_GATED_PERIODS) && DevTrGetInputCount(gen) > 0)
+      if(LstDevCanOpen(IDKIND_SERIALNUMBER, serialNumber, DEVICETYPE_GENERATOR))
       {
-        break;
-      }
-      else
-      {
-        gen = LIBTIEPIE_HANDLE_INVALID;
+        gen = LstOpenGenerator(IDKIND_SERIALNUMBER, serialNumber);
+        CHECK_LAST_STATUS();
+
+        // Check for valid handle and arbitrary support:
+        if(gen != LIBTIEPIE_HANDLE_INVALID && (GenGetModesNative(gen) & GM_GATED_PERIODS) && DevTrGetInputCount(gen) > 0)
+        {
+          break;
+        }
+        else
+        {
+          gen = LIBTIEPIE_HANDLE_INVALID;
+        }
       }
     }
   }
+  while(gen == LIBTIEPIE_HANDLE_INVALID && waitForDiscovery()); // Not found, retry when network search completes.
 
   if(gen != LIBTIEPIE_HANDLE_INVALID)
   {
@@ -124,6 +127,9 @@ int main(int argc, char* argv[])
     status = EXIT_FAILURE;
   }
 
+  // Stop device discovery:
+  stopDiscovery();
+
   // Exit library:
   LibExit();
 
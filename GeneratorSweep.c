@@ -0,0 +1,227 @@
+/**
+ * GeneratorSweep.c
+ *
+ * This example sweeps the frequency and amplitude of a sine and measures how long each setting takes to apply.
+ * Usage: GeneratorSweep [lin|log <start Hz> <stop Hz> <points> [dwell ms] [start V] [stop V]]
+ *        GeneratorSweep list <file> [dwell ms]
+ * The default is a log sweep from 100 Hz to 1 MHz in 1000 points at 2 V, without dwell time.
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <inttypes.h>
+#include <libtiepie.h>
+#include "CheckStatus.h"
+#include "Discovery.h"
+#include "Latency.h"
+#include "PrintInfo.h"
+#include "Sweep.h"
+#include "Utils.h"
+
+// Apply a setting on the first point or when it changed, keep the call latency and the relative deviation of the value set.
+// A macro, so status checks report the calling line and traced builds time the setter:
+#define SWEEP_SET(gen, function, first, value, previous, latency, deviation) \
+  do \
+  { \
+    if((first) || (value) != (previous)) \
+    { \
+      const uint64_t callStart = getTimeNanoSeconds(); \
+      const double actual = function((gen), (value)); \
+      latencyAdd(&latency, getTimeNanoSeconds() - callStart); \
+      CHECK_LAST_STATUS_FAST(); \
+      if((value) != 0 && fabs(actual / (value) - 1) > deviation) \
+        deviation = fabs(actual / (value) - 1); \
+    } \
+  } while(0)
+
+int main(int argc, char* argv[])
+{
+  int status = EXIT_SUCCESS;
+  Sweep_t sweep;
+  double dwell = 0; // ms
+  bool8_t ok;
+
+  // Create sweep:
+  if(argc > 2 && strcmp(argv[1], "list") == 0)
+  {
+    ok = loadSweep(&sweep, argv[2]);
+    if(argc > 3)
+      dwell = atof(argv[3]);
+  }
+  else if(argc > 4 && (strcmp(argv[1], "lin") == 0 || strcmp(argv[1], "log") == 0))
+  {
+    if(argc > 5)
+      dwell = atof(argv[5]);
+    const double startAmplitude = argc > 6 ? atof(argv[6]) : 2;
+    ok = createSweep(&sweep, strcmp(argv[1], "log") == 0 ? SWEEP_LOG : SWEEP_LINEAR, (uint32_t)strtoul(argv[4], NULL, 10), atof(argv[2]), atof(argv[3]), startAmplitude, argc > 7 ? atof(argv[7]) : startAmplitude, 0);
+  }
+  else if(argc == 1)
+  {
+    ok = createSweep(&sweep, SWEEP_LOG, 1000, 100, 1e6, 2, 2, 0);
+  }
+  else
+  {
+    ok = BOOL8_FALSE;
+  }
+
+  if(!ok || dwell < 0)
+  {
+    fprintf(stderr, "Usage: %s [lin|log <start Hz> <stop Hz> <points> [dwell ms] [start V] [stop V]]" NEWLINE, argv[0]);
+    fprintf(stderr, "       %s list <file> [dwell ms]" NEWLINE, argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  // Initialize library:
+  LibInit();
+
+  // Print library information:
+  printLibraryInfo();
+
+  // Update device list, search local devices first and network devices in the background:
+  startDiscovery(DISCOVERY_LOCAL_FIRST, printDiscoveredDevice, NULL);
+
+  // Try to open a generator:
+  LibTiePieHandle_t gen = LIBTIEPIE_HANDLE_INVALID;
+
+  do
+  {
+    for(uint32_t index = 0; index < LstGetCount(); index++)
+    {
+      // Open by serial number, indices change when network devices are added in the background:
+      const uint32_t serialNumber = LstDevGetSerialNumber(IDKIND_INDEX, index);
+
+      if(LstDevCanOpen(IDKIND_SERIALNUMBER, serialNumber, DEVICETYPE_GENERATOR))
+      {
+        gen = LstOpenGenerator(IDKIND_SERIALNUMBER, serialNumber);
+        CHECK_LAST_STATUS();
+
+        // Check for valid handle:
+        if(gen != LIBTIEPIE_HANDLE_INVALID)
+        {
+          break;
+        }
+      }
+    }
+  }
+  while(gen == LIBTIEPIE_HANDLE_INVALID && waitForDiscovery()); // Not found, retry when network search completes.
+
+  if(gen != LIBTIEPIE_HANDLE_INVALID)
+  {
+    Latency_t frequencyLatency, amplitudeLatency, offsetLatency, pointLatency;
+    double frequencyDeviation = 0;
+    double amplitudeDeviation = 0;
+    double offsetDeviation = 0;
+    uint32_t lateCount = 0;
+
+    latencyInit(&frequencyLatency);
+    latencyInit(&amplitudeLatency);
+    latencyInit(&offsetLatency);
+    latencyInit(&pointLatency);
+
+    // Set signal type:
+    GenSetSignalType(gen, ST_SINE);
+    CHECK_LAST_STATUS();
+
+    // Set first point:
+    GenSetFrequency(gen, sweep.points[0].frequency);
+    CHECK_LAST_STATUS();
+
+    GenSetAmplitude(gen, sweep.points[0].amplitude);
+    CHECK_LAST_STATUS();
+
+    GenSetOffset(gen, sweep.points[0].offset);
+    CHECK_LAST_STATUS();
+
+    // Enable output:
+    GenSetOutputOn(gen, BOOL8_TRUE);
+    CHECK_LAST_STATUS();
+
+    // Print generator info:
+    printDeviceInfo(gen);
+
+    // Start signal generation:
+    GenStart(gen);
+    CHECK_LAST_STATUS();
+
+    printf("Sweeping %" PRIu32 " points, %.3f ms dwell time..." NEWLINE, sweep.count, dwell);
+
+    const uint64_t sweepStart = getTimeNanoSeconds();
+    const uint64_t dwellNanoSeconds = (uint64_t)(dwell * 1e6);
+    const SweepPoint_t* previous = NULL;
+
+    for(uint32_t i = 0; i < sweep.count; i++)
+    {
+      const SweepPoint_t* point = &sweep.points[i];
+      const uint64_t pointStart = getTimeNanoSeconds();
+
+      SWEEP_SET(gen, GenSetFrequency, i == 0, point->frequency, previous->frequency, frequencyLatency, frequencyDeviation);
+      SWEEP_SET(gen, GenSetAmplitude, i == 0, point->amplitude, previous->amplitude, amplitudeLatency, amplitudeDeviation);
+      SWEEP_SET(gen, GenSetOffset, i == 0, point->offset, previous->offset, offsetLatency, offsetDeviation);
+
+      latencyAdd(&pointLatency, getTimeNanoSeconds() - pointStart);
+      previous = point;
+
+      // Dwell on an absolute schedule, so late points don't delay the rest of the sweep:
+      if(dwellNanoSeconds > 0)
+      {
+        const uint64_t deadline = sweepStart + (i + 1) * dwellNanoSeconds;
+
+        if(getTimeNanoSeconds() > deadline)
+          lateCount++;
+        else
+          sleepUntil(deadline);
+      }
+    }
+
+    const double seconds = (getTimeNanoSeconds() - sweepStart) / 1e9;
+
+    // Stop generator:
+    GenStop(gen);
+    CHECK_LAST_STATUS();
+
+    // Disable output:
+    GenSetOutputOn(gen, BOOL8_FALSE);
+    CHECK_LAST_STATUS();
+
+    // Print results:
+    printf("Sweep done in %.3f s, %.1f points/s" NEWLINE, seconds, sweep.count / seconds);
+    if(dwellNanoSeconds > 0)
+      printf("Points applied after their dwell time: %" PRIu32 NEWLINE, lateCount);
+    printLatencyHeader();
+    printLatency("GenSetFrequency", &frequencyLatency);
+    printLatency("GenSetAmplitude", &amplitudeLatency);
+    printLatency("GenSetOffset", &offsetLatency);
+    printLatency("Point", &pointLatency);
+    printf("Largest deviation of the value set: frequency %.3g %%, amplitude %.3g %%, offset %.3g %%" NEWLINE,
+           frequencyDeviation * 100, amplitudeDeviation * 100, offsetDeviation * 100);
+    printf("Shortest dwell time for 99 %% of the points: %.3f ms" NEWLINE, latencyPercentile(&pointLatency, 0.99) / 1e6);
+
+    latencyFree(&frequencyLatency);
+    latencyFree(&amplitudeLatency);
+    latencyFree(&offsetLatency);
+    latencyFree(&pointLatency);
+
+    // Close generator:
+    ObjClose(gen);
+    CHECK_LAST_STATUS();
+  }
+  else
+  {
+    fprintf(stderr, "No generator available!" NEWLINE);
+    status = EXIT_FAILURE;
+  }
+
+  // Stop device discovery:
+  stopDiscovery();
+
+  // Exit library:
+  LibExit();
+
+  freeSweep(&sweep);
+
+  return status;
+}
@@ -0,0 +1,42 @@
+TEMPLATE = app
+CONFIG += console
+CONFIG -= app_bundle
+CONFIG -= qt
+
+LIBS += -ltiepie -lpthread
+
+win32 {
+  msvc*:error("The Microsoft Visual C++ Compiler is not supported, please use MinGW.")
+
+  QMAKE_CFLAGS += -std=c99
+  LIBS += -L$$PWD
+  COPY_FILE_TO_BUILD_DIRECTORY += $$PWD\libtiepie.dll
+}
+
+unix {
+  QMAKE_CFLAGS += -std=gnu99 -pthread
+  LIBS += -lm
+}
+
+HEADERS += CheckStatus.h \
+           DeviceInfo.h \
+           Discovery.h \
+           Latency.h \
+           PrintInfo.h \
+           Sweep.h \
+           Utils.h
+
+
+SOURCES += GeneratorSweep.c \
+           CheckStatus.c \
+           DeviceInfo.c \
+           Discovery.c \
+           Latency.c \
+           PrintInfo.c \
+           Sweep.c \
+           Utils.c
+
+# Copy files to build directory:
+for(FILE,COPY_FILE_TO_BUILD_DIRECTORY) {
+  QMAKE_POST_LINK += $$quote($(COPY_FILE) \"$${FILE}\" \"$$OUT_PWD/\"$(DESTDIR) $$escape_expand(\n\t))
+}
@@ -0,0 +1,398 @@
+/**
+ * GeneratorTriggerLatency.c
+ *
+ * This example measures the latency from an external trigger to the start of a triggered or gated burst.
+ * Connect the trigger signal to the generator trigger input (EXT 1 or EXT 2) and to channel 1,
+ * and the generator output to channel 2.
+ * When the other EXT pin is available as trigger output, the device fires the trigger itself: connect it to the trigger input.
+ * Otherwise an external trigger source is needed.
+ * The oscilloscope triggers on the trigger signal, the burst onset is located in each measurement.
+ * The latencies are written to GeneratorTriggerLatency.csv.
+ * Usage: GeneratorTriggerLatency [triggered|gated] [events], default triggered, 1000 events.
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <inttypes.h>
+#include <libtiepie.h>
+#include "CheckStatus.h"
+#include "Discovery.h"
+#include "Latency.h"
+#include "PrintInfo.h"
+#include "SignalAnalysis.h"
+#include "Utils.h"
+
+#define SAMPLE_FREQUENCY 100e6 // 100 MHz, or the maximum if lower.
+#define RECORD_LENGTH 10000 // 10 kS
+#define PRE_SAMPLE_RATIO 0.1 // 10 %
+#define GENERATOR_AMPLITUDE 1 // V
+#define ONSET_THRESHOLD 0.25 // Of the amplitude.
+
+int main(int argc, char* argv[])
+{
+  int status = EXIT_SUCCESS;
+
+  // Check arguments:
+  const bool8_t gated = argc > 1 && strcmp(argv[1], "gated") == 0;
+  const uint32_t eventCount = argc > 2 ? (uint32_t)strtoul(argv[2], NULL, 10) : 1000;
+  if((argc > 1 && !gated && strcmp(argv[1], "triggered") != 0) || eventCount == 0)
+  {
+    fprintf(stderr, "Usage: %s [triggered|gated] [events]" NEWLINE, argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  // Initialize library:
+  LibInit();
+
+  // Print library information:
+  printLibraryInfo();
+
+  // Update device list, search local devices first and network devices in the background:
+  startDiscovery(DISCOVERY_LOCAL_FIRST, printDiscoveredDevice, NULL);
+
+  // Try to open an oscilloscope with block measurement support and a generator in the same device:
+  LibTiePieHandle_t scp = LIBTIEPIE_HANDLE_INVALID;
+  LibTiePieHandle_t gen = LIBTIEPIE_HANDLE_INVALID;
+
+  do
+  {
+    for(uint32_t index = 0; index < LstGetCount(); index++)
+    {
+      // Open by serial number, indices change when network devices are added in the background:
+      const uint32_t serialNumber = LstDevGetSerialNumber(IDKIND_INDEX, index);
+
+      if(LstDevCanOpen(IDKIND_SERIALNUMBER, serialNumber, DEVICETYPE_OSCILLOSCOPE) && LstDevCanOpen(IDKIND_SERIALNUMBER, serialNumber, DEVICETYPE_GENERATOR))
+      {
+        scp = LstOpenOscilloscope(IDKIND_SERIALNUMBER, serialNumber);
+        CHECK_LAST_STATUS();
+
+        // Check for valid handle, block measurement support and two channels:
+        if(scp != LIBTIEPIE_HANDLE_INVALID && (ScpGetMeasureModes(scp) & MM_BLOCK) && ScpGetChannelCount(scp) >= 2)
+        {
+          gen = LstOpenGenerator(IDKIND_SERIALNUMBER, serialNumber);
+          CHECK_LAST_STATUS();
+
+          // Check for valid handle:
+          if(gen != LIBTIEPIE_HANDLE_INVALID)
+          {
+            break;
+          }
+
+          // No generator, close oscilloscope:
+          ObjClose(scp);
+          CHECK_LAST_STATUS();
+        }
+
+        scp = LIBTIEPIE_HANDLE_INVALID;
+      }
+    }
+  }
+  while(scp == LIBTIEPIE_HANDLE_INVALID && waitForDiscovery()); // Not found, retry when network search completes.
+
+  if(scp != LIBTIEPIE_HANDLE_INVALID && gen != LIBTIEPIE_HANDLE_INVALID)
+  {
+    // Generator settings:
+
+    // Set signal type:
+    GenSetSignalType(gen, ST_SQUARE);
+    CHECK_LAST_STATUS();
+
+    // Set frequency:
+    GenSetFrequency(gen, 100e3); // 100 kHz
+    CHECK_LAST_STATUS();
+
+    // Set amplitude:
+    GenSetAmplitude(gen, GENERATOR_AMPLITUDE);
+    CHECK_LAST_STATUS();
+
+    // Set offset:
+    GenSetOffset(gen, 0); // 0 V
+    CHECK_LAST_STATUS();
+
+    // Set mode:
+    GenSetMode(gen, gated ? GM_GATED_PERIODS : GM_BURST_COUNT);
+    CHECK_LAST_STATUS();
+
+    if(!gated)
+    {
+      // Set burst count:
+      GenSetBurstCount(gen, 2); // 2 periods
+      CHECK_LAST_STATUS();
+    }
+
+    // Locate trigger input:
+    uint16_t inputIndex = DevTrGetInputIndexById(gen, TIID_EXT1);
+    uint32_t outputId = TOID_EXT2; // The other one, to fire the trigger.
+    CHECK_LAST_STATUS();
+
+    if(inputIndex == LIBTIEPIE_TRIGGERIO_INDEX_INVALID)
+    {
+      inputIndex = DevTrGetInputIndexById(gen, TIID_EXT2);
+      outputId = TOID_EXT1;
+      CHECK_LAST_STATUS();
+    }
+
+    // Locate trigger output:
+    const uint16_t outputIndex = DevTrGetOutputIndexById(gen, outputId);
+    CHECK_LAST_STATUS();
+
+    if(inputIndex != LIBTIEPIE_TRIGGERIO_INDEX_INVALID)
+    {
+      // Enable trigger input:
+      DevTrInSetEnabled(gen, inputIndex, BOOL8_TRUE);
+      CHECK_LAST_STATUS();
+
+      if(!gated)
+      {
+        // Set trigger input kind:
+        DevTrInSetKind(gen, inputIndex, TK_FALLINGEDGE);
+        CHECK_LAST_STATUS();
+      }
+
+      if(outputIndex != LIBTIEPIE_TRIGGERIO_INDEX_INVALID)
+      {
+        // Enable trigger output, fired by DevTrOutTrigger():
+        DevTrOutSetEnabled(gen, outputIndex, BOOL8_TRUE);
+        CHECK_LAST_STATUS();
+
+        DevTrOutSetEvent(gen, outputIndex, TOE_MANUAL);
+        CHECK_LAST_STATUS();
+      }
+
+      // Oscilloscope settings:
+
+      const uint16_t channelCount = ScpGetChannelCount(scp);
+      CHECK_LAST_STATUS();
+
+      // Set measure mode:
+      ScpSetMeasureMode(scp, MM_BLOCK);
+
+      // Set sample frequency:
+      const double sampleFrequency = ScpSetSampleFrequency(scp, fmin(SAMPLE_FREQUENCY, ScpGetSampleFrequencyMax(scp)));
+      CHECK_LAST_STATUS();
+
+      // Set record length:
+      uint64_t recordLength = ScpSetRecordLength(scp, RECORD_LENGTH);
+      CHECK_LAST_STATUS();
+
+      // Set pre sample ratio:
+      ScpSetPreSampleRatio(scp, PRE_SAMPLE_RATIO);
+
+      // Only measure the trigger signal and the generator output:
+      for(uint16_t ch = 0; ch < channelCount; ch++)
+      {
+        ScpChSetEnabled(scp, ch, ch < 2);
+        CHECK_LAST_STATUS_FAST();
+
+        ScpChTrSetEnabled(scp, ch, BOOL8_FALSE);
+        CHECK_LAST_STATUS_FAST();
+      }
+
+      for(uint16_t ch = 0; ch < 2; ch++)
+      {
+        // Set range:
+        ScpChSetRange(scp, ch, 8); // 8 V
+        CHECK_LAST_STATUS();
+
+        // Set coupling:
+        ScpChSetCoupling(scp, ch, CK_DCV); // DC Volt
+        CHECK_LAST_STATUS();
+      }
+
+      // Trigger on the edge that starts the burst, falling for triggered bursts, rising for gated bursts:
+      const bool8_t rising = gated;
+
+      ScpChTrSetEnabled(scp, 0, BOOL8_TRUE);
+      CHECK_LAST_STATUS();
+
+      ScpChTrSetKind(scp, 0, rising ? TK_RISINGEDGE : TK_FALLINGEDGE);
+      CHECK_LAST_STATUS();
+
+      ScpChTrSetLevel(scp, 0, 0, 0.5); // 50 %
+      CHECK_LAST_STATUS();
+
+      ScpChTrSetHysteresis(scp, 0, 0, 0.05); // 5 %
+      CHECK_LAST_STATUS();
+
+      // Set trigger timeout:
+      ScpSetTriggerTimeOut(scp, TO_INFINITY); // Wait for a trigger.
+      CHECK_LAST_STATUS();
+
+      // Enable output:
+      GenSetOutputOn(gen, BOOL8_TRUE);
+      CHECK_LAST_STATUS();
+
+      // Print oscilloscope info:
+      printDeviceInfo(scp);
+
+      // Print generator info:
+      printDeviceInfo(gen);
+
+      // Start signal generation, it waits for the trigger input:
+      GenStart(gen);
+      CHECK_LAST_STATUS();
+
+      // Create data buffers:
+      float* channelData[2];
+      channelData[0] = malloc(sizeof(float) * recordLength);
+      channelData[1] = malloc(sizeof(float) * recordLength);
+      double* latencies = malloc(sizeof(double) * eventCount);
+
+      Latency_t latency;
+      latencyInit(&latency);
+      uint32_t missedCount = 0;
+      uint32_t doneCount = 0;
+      uint64_t analysisTime = 0;
+
+      if(outputIndex == LIBTIEPIE_TRIGGERIO_INDEX_INVALID)
+        printf("No free trigger output, waiting for %" PRIu32 " external triggers..." NEWLINE, eventCount);
+      else
+        printf("Firing %" PRIu32 " triggers..." NEWLINE, eventCount);
+
+      for(uint32_t i = 0; i < eventCount; i++)
+      {
+        // Start measurement:
+        ScpStart(scp);
+        CHECK_LAST_STATUS_FAST();
+
+        // Fire trigger:
+        if(outputIndex != LIBTIEPIE_TRIGGERIO_INDEX_INVALID)
+        {
+          DevTrOutTrigger(gen, outputIndex);
+          CHECK_LAST_STATUS_FAST();
+        }
+
+        // Wait for measurement to complete:
+        while(!ScpIsDataReady(scp) && !ObjIsRemoved(scp))
+        {
+          sleepMiliSeconds(1); // 1 ms delay, to save CPU time.
+        }
+
+        if(ObjIsRemoved(scp))
+        {
+          fprintf(stderr, "Device gone!" NEWLINE);
+          status = EXIT_FAILURE;
+          break;
+        }
+
+        // Get the data from the scope:
+        const uint64_t length = ScpGetData(scp, channelData, 2, 0, recordLength);
+        CHECK_LAST_STATUS_FAST();
+
+        const uint64_t start = getTimeNanoSeconds();
+
+        // Locate the trigger edge at half the trigger signal swing:
+        float min, max;
+        getMinMax(channelData[0], length, &min, &max);
+        const double edge = findCrossing(channelData[0], length, (min + max) / 2, rising);
+
+        // Locate the burst onset after the edge, relative to the output level before it:
+        latencies[i] = -1;
+        if(edge >= 1)
+        {
+          const uint64_t edgeIndex = (uint64_t)edge;
+          const float baseline = (float)getMean(channelData[1], edgeIndex);
+          const float threshold = (float)(GENERATOR_AMPLITUDE * ONSET_THRESHOLD);
+          const uint64_t onsetIndex = edgeIndex + findDeviation(channelData[1] + edgeIndex, length - edgeIndex, baseline, threshold);
+
+          if(onsetIndex < length && onsetIndex > edgeIndex)
+          {
+            // Interpolate where the threshold is passed:
+            const float previous = fabsf(channelData[1][onsetIndex - 1] - baseline);
+            const float current = fabsf(channelData[1][onsetIndex] - baseline);
+            const double onset = (onsetIndex - 1) + (double)(threshold - previous) / (current - previous);
+
+            // Interpolation can put the onset just before the edge, a burst can't start before its trigger:
+            latencies[i] = fmax(0, (onset - edge) / sampleFrequency);
+            latencyAdd(&latency, (uint64_t)llround(latencies[i] * 1e9));
+          }
+        }
+
+        if(latencies[i] < 0)
+          missedCount++;
+
+        analysisTime += getTimeNanoSeconds() - start;
+        doneCount++;
+      }
+
+      // Stop generator:
+      GenStop(gen);
+      CHECK_LAST_STATUS();
+
+      // Disable output:
+      GenSetOutputOn(gen, BOOL8_FALSE);
+      CHECK_LAST_STATUS();
+
+      // Print results:
+      printf("%" PRIu64 " events measured, %" PRIu32 " without edge or burst onset" NEWLINE, latency.count, missedCount);
+      printLatencyHeader();
+      printLatency(gated ? "Gate to output" : "Trigger to output", &latency);
+      printf("Jitter: %.3f us RMS, %.3f us peak to peak" NEWLINE, latencyStandardDeviation(&latency) / 1e3, (latency.max - latency.min) / 1e3);
+      printf("Edge detection: %.2f us per event" NEWLINE, doneCount > 0 ? analysisTime / 1e3 / doneCount : 0);
+
+      // Open file with write/update permissions:
+      const char* filename = "GeneratorTriggerLatency.csv";
+      FILE* csv = fopen(filename, "w");
+      if(csv)
+      {
+        // Write csv header:
+        fprintf(csv, "Event;Latency (us)" NEWLINE);
+
+        // Write the latencies to csv, events without burst onset are left empty:
+        for(uint32_t i = 0; i < doneCount; i++)
+        {
+          if(latencies[i] >= 0)
+            fprintf(csv, "%" PRIu32 ";%f" NEWLINE, i + 1, latencies[i] * 1e6);
+          else
+            fprintf(csv, "%" PRIu32 ";" NEWLINE, i + 1);
+        }
+
+        printf("Data written to: %s" NEWLINE, filename);
+
+        // Close file:
+        fclose(csv);
+      }
+      else
+      {
+        fprintf(stderr, "Couldn't open file: %s" NEWLINE, filename);
+        status = EXIT_FAILURE;
+      }
+
+      // Free data buffers:
+      latencyFree(&latency);
+      free(latencies);
+      free(channelData[1]);
+      free(channelData[0]);
+    }
+    else
+    {
+      fprintf(stderr, "Unknown trigger input!" NEWLINE);
+      status = EXIT_FAILURE;
+    }
+
+    // Close oscilloscope:
+    ObjClose(scp);
+    CHECK_LAST_STATUS();
+
+    // Close generator:
+    ObjClose(gen);
+    CHECK_LAST_STATUS();
+  }
+  else
+  {
+    fprintf(stderr, "No oscilloscope available with block measurement support and two channels or generator available in the same unit!" NEWLINE);
+    status = EXIT_FAILURE;
+  }
+
+  // Stop device discovery:
+  stopDiscovery();
+
+  // Exit library:
+  LibExit();
+
+  return status;
+}
@@ -0,0 +1,150 @@
+/**
+ * I2CBusScan.c
+ *
+ * This example scans the buses of all I2C hosts supported by LibTiePie for responding devices.
+ * All valid 7-bit addresses (0x08 to 0x77) are probed with a one byte read, each host is scanned on its own thread.
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include <libtiepie.h>
+#include "CheckStatus.h"
+#include "Discovery.h"
+#include "PrintInfo.h"
+#include "Utils.h"
+
+#define ADDRESS_FIRST 0x08
+#define ADDRESS_LAST 0x77
+
+typedef struct
+{
+  LibTiePieHandle_t i2c;
+  pthread_t thread;
+  bool8_t started;
+  uint8_t responds[ADDRESS_LAST + 1];
+  uint8_t internal[ADDRESS_LAST + 1];
+  uint64_t duration; // ns
+} Scan_t;
+
+static void* scanBus(void* arg)
+{
+  Scan_t* scan = arg;
+  const uint64_t start = getTimeNanoSeconds();
+
+  for(uint16_t address = ADDRESS_FIRST; address <= ADDRESS_LAST; address++)
+  {
+    uint8_t value;
+
+    // A device acknowledges its address:
+    scan->responds[address] = I2CReadByte(scan->i2c, address, &value);
+    scan->internal[address] = I2CIsInternalAddress(scan->i2c, address);
+  }
+
+  scan->duration = getTimeNanoSeconds() - start;
+
+  return NULL;
+}
+
+int main(int argc, char* argv[])
+{
+  int status = EXIT_SUCCESS;
+
+  // Initialize library:
+  LibInit();
+
+  // Print library information:
+  printLibraryInfo();
+
+  // Update device list, local and network devices:
+  startDiscovery(DISCOVERY_BLOCKING, NULL, NULL);
+
+  // Open all I2C hosts:
+  const uint32_t deviceCount = LstGetCount();
+  Scan_t* scans = calloc(deviceCount > 0 ? deviceCount : 1, sizeof(Scan_t));
+  uint32_t scanCount = 0;
+
+  for(uint32_t index = 0; index < deviceCount; index++)
+  {
+    if(LstDevCanOpen(IDKIND_INDEX, index, DEVICETYPE_I2CHOST))
+    {
+      LibTiePieHandle_t i2c = LstOpenI2CHost(IDKIND_INDEX, index);
+      CHECK_LAST_STATUS();
+
+      if(i2c != LIBTIEPIE_HANDLE_INVALID)
+      {
+        scans[scanCount++].i2c = i2c;
+      }
+    }
+  }
+
+  if(scanCount > 0)
+  {
+    const uint64_t start = getTimeNanoSeconds();
+
+    // Start a scan per host, scan on this thread if a thread can't be created:
+    for(uint32_t i = 0; i < scanCount; i++)
+    {
+      scans[i].started = pthread_create(&scans[i].thread, NULL, scanBus, &scans[i]) == 0;
+      if(!scans[i].started)
+        scanBus(&scans[i]);
+    }
+
+    for(uint32_t i = 0; i < scanCount; i++)
+    {
+      if(scans[i].started)
+        pthread_join(scans[i].thread, NULL);
+    }
+
+    const uint64_t duration = getTimeNanoSeconds() - start;
+
+    // Print results:
+    for(uint32_t i = 0; i < scanCount; i++)
+    {
+      const Scan_t* result = &scans[i];
+      unsigned int count = 0;
+
+      printf("I2C host s/n %" PRIu32 ": scanned in %.1f ms" NEWLINE, DevGetSerialNumber(result->i2c), result->duration / 1e6);
+      CHECK_LAST_STATUS();
+
+      for(uint16_t address = ADDRESS_FIRST; address <= ADDRESS_LAST; address++)
+      {
+        if(result->responds[address])
+        {
+          printf("  0x%02X%s" NEWLINE, address, result->internal[address] ? " (internal)" : "");
+          count++;
+        }
+      }
+
+      if(count == 0)
+        printf("  No devices found" NEWLINE);
+    }
+
+    printf("%" PRIu32 " host(s) scanned in %.1f ms" NEWLINE, scanCount, duration / 1e6);
+
+    // Close I2C hosts:
+    for(uint32_t i = 0; i < scanCount; i++)
+    {
+      ObjClose(scans[i].i2c);
+      CHECK_LAST_STATUS();
+    }
+  }
+  else
+  {
+    fprintf(stderr, "No I2C host available!" NEWLINE);
+    status = EXIT_FAILURE;
+  }
+
+  free(scans);
+
+  // Stop device discovery:
+  stopDiscovery();
+
+  // Exit library:
+  LibExit();
+
+  return status;
+}
@@ -0,0 +1,38 @@
+TEMPLATE = app
+CONFIG += console
+CONFIG -= app_bundle
+CONFIG -= qt
+
+LIBS += -ltiepie -lpthread
+
+win32 {
+  msvc*:error("The Microsoft Visual C++ Compiler is not supported, please use MinGW.")
+
+  QMAKE_CFLAGS += -std=c99
+  LIBS += -L$$PWD
+  COPY_FILE_TO_BUILD_DIRECTORY += $$PWD\libtiepie.dll
+}
+
+unix {
+  QMAKE_CFLAGS += -std=gnu99 -pthread
+  LIBS += -lm
+}
+
+HEADERS += CheckStatus.h \
+           DeviceInfo.h \
+           Discovery.h \
+           PrintInfo.h \
+           Utils.h
+
+
+SOURCES += I2CBusScan.c \
+           CheckStatus.c \
+           DeviceInfo.c \
+           Discovery.c \
+           PrintInfo.c \
+           Utils.c
+
+# Copy files to build directory:
+for(FILE,COPY_FILE_TO_BUILD_DIRECTORY) {
+  QMAKE_POST_LINK += $$quote($(COPY_FILE) \"$${FILE}\" \"$$OUT_PWD/\"$(DESTDIR) $$escape_expand(\n\t))
+}
@@ -10,28 +10,12 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <libtiepie.h>
+#include "AD5667.h"
 #include "CheckStatus.h"
+#include "Discovery.h"
 #include "PrintInfo.h"
 #include "Utils.h"
 
-// AD5667 address:
-#define AD5667_ADDRESS 12
-
-// AD5667 registers:
-#define AD5667_REG_DAC_A   0x00
-#define AD5667_REG_DAC_B   0x01
-#define AD5667_REG_DAC_ALL 0x07
-
-// AD5667 commands:
-#define AD5667_CMD_WRITE            0x00
-#define AD5667_CMD_UPDATE           0x08
-#define AD5667_CMD_WRITE_UPDATE_ALL 0x10
-#define AD5667_CMD_WRITE_UPDATE     0x18
-#define AD5667_CMD_POWER            0x20
-#define AD5667_CMD_RESET            0x28
-#define AD5667_CMD_LDAC_SETUP       0x30
-#define AD5667_CMD_REF_SETUP        0x38
-
 int main(int argc, char* argv[])
 {
   int status = EXIT_SUCCESS;
@@ -42,30 +26,32 @@ int main(int argc, char* argv[])
   // Print library information:
   printLibraryInfo();
 
-  // Enable network search:
-  NetSetAutoDetectEnabled(BOOL8_TRUE);
-  CHECK_LAST_STATUS();
-
-  // Update device list:
-  LstUpdate();
-  CHECK_LAST_STATUS();
+  // Update device list, search local devices first and network devices in the background:
+  startDiscovery(DISCOVERY_LOCAL_FIRST, printDiscoveredDevice, NULL);
 
   // Try to open an I2C host:
   LibTiePieHandle_t i2c = LIBTIEPIE_HANDLE_INVALID;
 
-  for(uint32_t index = 0; index < LstGetCount(); index++)
+  do
   {
-    if(LstDevCanOpen(IDKIND_INDEX, index, DEVICETYPE_I2CHOST))
+    for(uint32_t index = 0; index < LstGetCount(); index++)
     {
-      i2c = LstOpenI2CHost(IDKIND_INDEX, index);
-      CHECK_LAST_STATUS();
+      // Open by serial number, indices change when network devices are added in the background:
+      const uint32_t serialNumber = LstDevGetSerialNumber(IDKIND_INDEX, index);
 
-      if(i2c)
+      if(LstDevCanOpen(IDKIND_SERIALNUMBER, serialNumber, DEVICETYPE_I2CHOST))
       {
-        break;
+        i2c = LstOpenI2CHost(IDKIND_SERIALNUMBER, serialNumber);
+        CHECK_LAST_STATUS();
+
+        if(i2c)
+        {
+          break;
+        }
       }
     }
   }
+  while(i2c == LIBTIEPIE_HANDLE_INVALID && waitForDiscovery()); // Not found, retry when network search completes.
 
   if(i2c != LIBTIEPIE_HANDLE_INVALID)
   {
@@ -90,6 +76,9 @@ int main(int argc, char* argv[])
     status = EXIT_FAILURE;
   }
 
+  // Stop device discovery:
+  stopDiscovery();
+
   // Exit library:
   LibExit();
 
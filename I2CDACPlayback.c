@@ -0,0 +1,231 @@
+/**
+ * I2CDACPlayback.c
+ *
+ * This example plays a waveform through DAC A of an Analog Devices AD5667 dual 16-bit DAC at a fixed update rate.
+ * A dedicated thread writes the samples at absolute deadlines on the monotonic clock, so the timing doesn't drift.
+ * Samples whose deadline has passed are skipped and counted as deadline misses.
+ * Usage: I2CDACPlayback [update rate Hz] [file], default 1 kHz and one second of a 10 Hz sine.
+ * The file contains raw float32 samples from -1 to 1, like GeneratorArbitraryFile uses.
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include <libtiepie.h>
+#include "AD5667.h"
+#include "CheckStatus.h"
+#include "Discovery.h"
+#include "Latency.h"
+#include "PrintInfo.h"
+#include "Utils.h"
+#include "WaveformFile.h"
+
+#ifndef M_PI
+#  define M_PI 3.14159265358979323846
+#endif
+
+typedef struct
+{
+  LibTiePieHandle_t i2c;
+  const uint16_t* samples;
+  uint64_t length;
+  uint64_t period; // ns
+  uint64_t start; // ns
+  uint64_t end; // ns
+  uint64_t missCount;
+  Latency_t wakeUp; // Lateness after the deadline.
+  Latency_t write; // I2C write duration.
+} Playback_t;
+
+static void* play(void* arg)
+{
+  Playback_t* playback = arg;
+  uint64_t i = 0;
+
+  playback->start = getTimeNanoSeconds() + playback->period; // First sample one period from now.
+
+  while(i < playback->length)
+  {
+    const uint64_t deadline = playback->start + i * playback->period;
+
+    // Sleep until the absolute deadline, no drift from the time spent writing:
+    sleepUntil(deadline);
+
+    const uint64_t wakeUp = getTimeNanoSeconds();
+    latencyAdd(&playback->wakeUp, wakeUp - deadline);
+
+    I2CWriteByteWord(playback->i2c, AD5667_ADDRESS, AD5667_CMD_WRITE_UPDATE | AD5667_REG_DAC_A, playback->samples[i]);
+    CHECK_LAST_STATUS_FAST();
+
+    const uint64_t now = getTimeNanoSeconds();
+    latencyAdd(&playback->write, now - wakeUp);
+
+    // Next sample, skip the ones that are already too late:
+    i++;
+    const uint64_t next = (now - playback->start) / playback->period + 1;
+    if(next > i)
+    {
+      playback->missCount += (next < playback->length ? next : playback->length) - i;
+      i = next;
+    }
+  }
+
+  playback->end = getTimeNanoSeconds();
+
+  return NULL;
+}
+
+int main(int argc, char* argv[])
+{
+  int status = EXIT_SUCCESS;
+
+  // Check arguments:
+  const double rate = argc > 1 ? atof(argv[1]) : 1e3;
+  if(rate <= 0 || rate > 1e6)
+  {
+    fprintf(stderr, "Usage: %s [update rate Hz] [file]" NEWLINE, argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  // Load or create the waveform:
+  Playback_t playback;
+  WaveformFile_t waveform;
+  uint16_t* samples;
+
+  if(argc > 2)
+  {
+    if(!openWaveformFile(&waveform, argv[2], WAVEFORM_FLOAT32))
+    {
+      return EXIT_FAILURE;
+    }
+
+    playback.length = waveform.length;
+    samples = malloc(sizeof(uint16_t) * playback.length);
+    for(uint64_t i = 0; samples && i < playback.length; i++)
+    {
+      const float value = waveform.data[i] < -1 ? -1 : (waveform.data[i] > 1 ? 1 : waveform.data[i]);
+      samples[i] = (uint16_t)lrintf((value + 1) * 32767.5f);
+    }
+
+    closeWaveformFile(&waveform);
+  }
+  else
+  {
+    playback.length = (uint64_t)ceil(rate);
+    samples = malloc(sizeof(uint16_t) * playback.length);
+    for(uint64_t i = 0; samples && i < playback.length; i++)
+    {
+      samples[i] = (uint16_t)lrint((sin(2 * M_PI * 10 * i / rate) + 1) * 32767.5); // 10 Hz
+    }
+  }
+
+  if(!samples)
+  {
+    fprintf(stderr, "Out of memory!" NEWLINE);
+    return EXIT_FAILURE;
+  }
+
+  // Initialize library:
+  LibInit();
+
+  // Print library information:
+  printLibraryInfo();
+
+  // Update device list, search local devices first and network devices in the background:
+  startDiscovery(DISCOVERY_LOCAL_FIRST, printDiscoveredDevice, NULL);
+
+  // Try to open an I2C host:
+  LibTiePieHandle_t i2c = LIBTIEPIE_HANDLE_INVALID;
+
+  do
+  {
+    for(uint32_t index = 0; index < LstGetCount(); index++)
+    {
+      // Open by serial number, indices change when network devices are added in the background:
+      const uint32_t serialNumber = LstDevGetSerialNumber(IDKIND_INDEX, index);
+
+      if(LstDevCanOpen(IDKIND_SERIALNUMBER, serialNumber, DEVICETYPE_I2CHOST))
+      {
+        i2c = LstOpenI2CHost(IDKIND_SERIALNUMBER, serialNumber);
+        CHECK_LAST_STATUS();
+
+        if(i2c)
+        {
+          break;
+        }
+      }
+    }
+  }
+  while(i2c == LIBTIEPIE_HANDLE_INVALID && waitForDiscovery()); // Not found, retry when network search completes.
+
+  if(i2c != LIBTIEPIE_HANDLE_INVALID)
+  {
+    // Print I2C host info:
+    printDeviceInfo(i2c);
+
+    // Turn on internal reference:
+    I2CWriteByteWord(i2c, AD5667_ADDRESS, AD5667_CMD_REF_SETUP | AD5667_REG_DAC_A, 1);
+    CHECK_LAST_STATUS();
+
+    playback.i2c = i2c;
+    playback.samples = samples;
+    playback.period = (uint64_t)llround(1e9 / rate);
+    playback.missCount = 0;
+    latencyInit(&playback.wakeUp);
+    latencyInit(&playback.write);
+
+    printf("Playing %" PRIu64 " samples at %.1f Hz..." NEWLINE, playback.length, rate);
+
+    // Play on a dedicated thread:
+    pthread_t thread;
+    if(pthread_create(&thread, NULL, play, &playback) == 0)
+    {
+      pthread_join(thread, NULL);
+
+      // Print results:
+      const double ideal = (playback.length - 1) * (playback.period / 1e9);
+      const double actual = (playback.end - playback.start) / 1e9;
+      printf("First to last sample: %.6f s, ideal %.6f s" NEWLINE, actual, ideal);
+      printf("Deadline misses: %" PRIu64 " of %" PRIu64 " samples" NEWLINE, playback.missCount, playback.length);
+      printLatencyHeader();
+      printLatency("Wake up after deadline", &playback.wakeUp);
+      printLatency("I2C write", &playback.write);
+      printf("Jitter: %.2f us RMS" NEWLINE, latencyStandardDeviation(&playback.wakeUp) / 1e3);
+    }
+    else
+    {
+      fprintf(stderr, "Couldn't create playback thread!" NEWLINE);
+      status = EXIT_FAILURE;
+    }
+
+    latencyFree(&playback.write);
+    latencyFree(&playback.wakeUp);
+
+    // Set DAC A to mid level:
+    I2CWriteByteWord(i2c, AD5667_ADDRESS, AD5667_CMD_WRITE_UPDATE | AD5667_REG_DAC_A, 0x8000);
+    CHECK_LAST_STATUS();
+
+    // Close I2C host:
+    ObjClose(i2c);
+    CHECK_LAST_STATUS();
+  }
+  else
+  {
+    fprintf(stderr, "No I2C host available!" NEWLINE);
+    status = EXIT_FAILURE;
+  }
+
+  // Stop device discovery:
+  stopDiscovery();
+
+  // Exit library:
+  LibExit();
+
+  free(samples);
+
+  return status;
+}
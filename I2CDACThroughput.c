@@ -0,0 +1,157 @@
+/**
+ * I2CDACThroughput.c
+ *
+ * This example measures how many updates per second can be sent to an Analog Devices AD5667 dual 16-bit DAC.
+ * Both DACs are updated with a ramp, per I2C speed with one call per update and with batched writes.
+ * Usage: I2CDACThroughput [updates per run] [updates per batch], default 2000 and 32.
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <inttypes.h>
+#include <libtiepie.h>
+#include "AD5667.h"
+#include "CheckStatus.h"
+#include "Discovery.h"
+#include "PrintInfo.h"
+#include "Utils.h"
+
+static const double speeds[] = {100e3, 400e3, 1e6, 3.4e6}; // Standard, fast, fast plus and high speed mode.
+#define SPEED_COUNT (sizeof(speeds) / sizeof(speeds[0]))
+
+// Ramp values, A rising and B falling:
+#define RAMP_A(i) ((uint16_t)((i) * 257))
+#define RAMP_B(i) ((uint16_t)~RAMP_A(i))
+
+int main(int argc, char* argv[])
+{
+  int status = EXIT_SUCCESS;
+
+  // Check arguments:
+  const uint32_t updateCount = argc > 1 ? (uint32_t)strtoul(argv[1], NULL, 10) : 2000;
+  const uint32_t batchSize = argc > 2 ? (uint32_t)strtoul(argv[2], NULL, 10) : 32;
+  if(updateCount == 0 || batchSize == 0)
+  {
+    fprintf(stderr, "Usage: %s [updates per run] [updates per batch]" NEWLINE, argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  // Initialize library:
+  LibInit();
+
+  // Print library information:
+  printLibraryInfo();
+
+  // Update device list, search local devices first and network devices in the background:
+  startDiscovery(DISCOVERY_LOCAL_FIRST, printDiscoveredDevice, NULL);
+
+  // Try to open an I2C host:
+  LibTiePieHandle_t i2c = LIBTIEPIE_HANDLE_INVALID;
+
+  do
+  {
+    for(uint32_t index = 0; index < LstGetCount(); index++)
+    {
+      // Open by serial number, indices change when network devices are added in the background:
+      const uint32_t serialNumber = LstDevGetSerialNumber(IDKIND_INDEX, index);
+
+      if(LstDevCanOpen(IDKIND_SERIALNUMBER, serialNumber, DEVICETYPE_I2CHOST))
+      {
+        i2c = LstOpenI2CHost(IDKIND_SERIALNUMBER, serialNumber);
+        CHECK_LAST_STATUS();
+
+        if(i2c)
+        {
+          break;
+        }
+      }
+    }
+  }
+  while(i2c == LIBTIEPIE_HANDLE_INVALID && waitForDiscovery()); // Not found, retry when network search completes.
+
+  if(i2c != LIBTIEPIE_HANDLE_INVALID)
+  {
+    // Print I2C host info:
+    printDeviceInfo(i2c);
+
+    // Turn on internal reference:
+    I2CWriteByteWord(i2c, AD5667_ADDRESS, AD5667_CMD_REF_SETUP | AD5667_REG_DAC_A, 1);
+    CHECK_LAST_STATUS();
+
+    // Two frames per update, unless both values are equal:
+    AD5667Queue_t queue;
+    if(ad5667QueueInit(&queue, i2c, AD5667_ADDRESS, 2 * batchSize))
+    {
+      const double speedMax = I2CGetSpeedMax(i2c);
+      CHECK_LAST_STATUS();
+
+      printf("%12s %16s %16s %16s" NEWLINE, "Speed (kHz)", "Single (upd/s)", "Batched (upd/s)", "I2C writes");
+
+      for(unsigned int s = 0; s < SPEED_COUNT && speeds[s] <= speedMax && status == EXIT_SUCCESS; s++)
+      {
+        // Set speed:
+        const double speed = I2CSetSpeed(i2c, speeds[s]);
+        CHECK_LAST_STATUS();
+
+        // One call per DAC value:
+        uint64_t start = getTimeNanoSeconds();
+        for(uint32_t i = 0; i < updateCount; i++)
+        {
+          I2CWriteByteWord(i2c, AD5667_ADDRESS, AD5667_CMD_WRITE | AD5667_REG_DAC_A, RAMP_A(i));
+          CHECK_LAST_STATUS_FAST();
+
+          I2CWriteByteWord(i2c, AD5667_ADDRESS, AD5667_CMD_WRITE_UPDATE_ALL | AD5667_REG_DAC_B, RAMP_B(i));
+          CHECK_LAST_STATUS_FAST();
+        }
+        const double single = updateCount / ((getTimeNanoSeconds() - start) / 1e9);
+
+        // Batched:
+        bool8_t ok = BOOL8_TRUE;
+        queue.writeCount = 0;
+        start = getTimeNanoSeconds();
+        for(uint32_t i = 0; i < updateCount; i++)
+        {
+          ok = ad5667QueueSetBoth(&queue, RAMP_A(i), RAMP_B(i)) && ok;
+        }
+        if(!ad5667QueueFlush(&queue) || !ok)
+        {
+          fprintf(stderr, "I2C write failed!" NEWLINE);
+          status = EXIT_FAILURE;
+        }
+        const double batched = updateCount / ((getTimeNanoSeconds() - start) / 1e9);
+
+        printf("%12.1f %16.1f %16.1f %16" PRIu64 "%s" NEWLINE, speed / 1e3, single, batched, queue.writeCount, queue.batched ? "" : " (not batched, refused by host)");
+      }
+
+      ad5667QueueFree(&queue);
+    }
+    else
+    {
+      fprintf(stderr, "Out of memory!" NEWLINE);
+      status = EXIT_FAILURE;
+    }
+
+    // Set both DACs to mid level:
+    I2CWriteByteWord(i2c, AD5667_ADDRESS, AD5667_CMD_WRITE_UPDATE | AD5667_REG_DAC_ALL, 0x8000);
+    CHECK_LAST_STATUS();
+
+    // Close I2C host:
+    ObjClose(i2c);
+    CHECK_LAST_STATUS();
+  }
+  else
+  {
+    fprintf(stderr, "No I2C host available!" NEWLINE);
+    status = EXIT_FAILURE;
+  }
+
+  // Stop device discovery:
+  stopDiscovery();
+
+  // Exit library:
+  LibExit();
+
+  return status;
+}
@@ -0,0 +1,110 @@
+/**
+ * Latency.c
+ *
+ * This file is part of the LibTiePie programming examples.
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#include "Latency.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include <inttypes.h>
+#include "Utils.h"
+
+void latencyInit(Latency_t* latency)
+{
+  latency->samples = NULL;
+  latency->count = 0;
+  latency->capacity = 0;
+  latency->total = 0;
+  latency->min = 0;
+  latency->max = 0;
+}
+
+void latencyFree(Latency_t* latency)
+{
+  free(latency->samples);
+  latencyInit(latency);
+}
+
+void latencyAdd(Latency_t* latency, uint64_t duration)
+{
+  if(latency->count == latency->capacity)
+  {
+    const uint64_t capacity = latency->capacity ? latency->capacity * 2 : 1024;
+    uint64_t* samples = realloc(latency->samples, sizeof(uint64_t) * capacity);
+    if(!samples)
+      return;
+    latency->samples = samples;
+    latency->capacity = capacity;
+  }
+
+  if(latency->count == 0 || duration < latency->min)
+    latency->min = duration;
+  if(duration > latency->max)
+    latency->max = duration;
+  latency->samples[latency->count++] = duration;
+  latency->total += duration;
+}
+
+static int compare(const void* a, const void* b)
+{
+  const uint64_t x = *(const uint64_t*)a;
+  const uint64_t y = *(const uint64_t*)b;
+
+  return x < y ? -1 : x > y;
+}
+
+uint64_t latencyPercentile(Latency_t* latency, double fraction)
+{
+  if(latency->count == 0)
+    return 0;
+
+  // Sorting keeps the sample set, only the order changes:
+  qsort(latency->samples, latency->count, sizeof(uint64_t), compare);
+
+  uint64_t index = (uint64_t)(fraction * (latency->count - 1) + 0.5);
+  if(index >= latency->count)
+    index = latency->count - 1;
+
+  return latency->samples[index];
+}
+
+double latencyStandardDeviation(const Latency_t* latency)
+{
+  if(latency->count < 2)
+    return 0;
+
+  const double mean = (double)latency->total / latency->count;
+  double sum = 0;
+
+  for(uint64_t i = 0; i < latency->count; i++)
+    sum += (latency->samples[i] - mean) * (latency->samples[i] - mean);
+
+  return sqrt(sum / (latency->count - 1));
+}
+
+void printLatencyHeader()
+{
+  printf("  %-24s %10s %10s %10s %10s %10s %10s" NEWLINE, "Latency (us)", "Count", "Mean", "Min", "p50", "p99", "Max");
+}
+
+void printLatency(const char* name, Latency_t* latency)
+{
+  if(latency->count == 0)
+  {
+    printf("  %-24s %10d" NEWLINE, name, 0);
+    return;
+  }
+
+  printf("  %-24s %10" PRIu64 " %10.2f %10.2f %10.2f %10.2f %10.2f" NEWLINE,
+         name,
+         latency->count,
+         (double)latency->total / latency->count / 1e3,
+         latency->min / 1e3,
+         latencyPercentile(latency, 0.50) / 1e3,
+         latencyPercentile(latency, 0.99) / 1e3,
+         latency->max / 1e3);
+}
@@ -0,0 +1,41 @@
+/**
+ * Latency.h
+ *
+ * This file is part of the LibTiePie programming examples.
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#ifndef _LATENCY_H_
+#define _LATENCY_H_
+
+#include <stdint.h>
+
+// Latency statistics of a series of measured durations in nanoseconds.
+// All samples are kept, so percentiles are exact.
+
+typedef struct
+{
+  uint64_t* samples;
+  uint64_t count;
+  uint64_t capacity;
+  uint64_t total;
+  uint64_t min;
+  uint64_t max;
+} Latency_t;
+
+void latencyInit(Latency_t* latency);
+void latencyFree(Latency_t* latency);
+void latencyAdd(Latency_t* latency, uint64_t duration);
+
+// Duration below which the given fraction (0..1) of the samples is, 0 if there are no samples:
+uint64_t latencyPercentile(Latency_t* latency, double fraction);
+
+// Standard deviation, the jitter:
+double latencyStandardDeviation(const Latency_t* latency);
+
+// Print a header and a row: name, count, mean, min, p50, p99 and max in microseconds.
+void printLatencyHeader();
+void printLatency(const char* name, Latency_t* latency);
+
+#endif
@@ -2,14 +2,32 @@ TEMPLATE = subdirs
 
 SUBDIRS = Generator.pro \
           GeneratorArbitrary.pro \
+          GeneratorArbitraryFile.pro \
           GeneratorBurst.pro \
+          GeneratorBurstSequence.pro \
           GeneratorGatedBurst.pro \
+          GeneratorSweep.pro \
+          GeneratorTriggerLatency.pro \
           GeneratorTriggeredBurst.pro \
+          I2CBusScan.pro \
           I2CDAC.pro \
+          I2CDACPlayback.pro \
+          I2CDACThroughput.pro \
           ListDevices.pro \
           OscilloscopeBlock.pro \
+          OscilloscopeBlockChannels.pro \
+          OscilloscopeBlockChunked.pro \
+          OscilloscopeBlockHugePages.pro \
           OscilloscopeBlockSegmented.pro \
           OscilloscopeCombineHS3HS4.pro \
           OscilloscopeConnectionTest.pro \
+          OscilloscopeConnectionTestMonitor.pro \
+          OscilloscopeConnectionTestMulti.pro \
+          OscilloscopeGeneratorBode.pro \
           OscilloscopeGeneratorTrigger.pro \
-          OscilloscopeStream.pro
+          OscilloscopeMeasurementPlan.pro \
+          OscilloscopeStream.pro \
+          OscilloscopeStreamAutoTune.pro \
+          OscilloscopeStreamRealTime.pro \
+          OscilloscopeStreamRecovery.pro \
+          ResampleBenchmark.pro
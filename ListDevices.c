@@ -2,6 +2,7 @@
  * ListDevices.c
  *
  * This example prints all the available devices to the screen.
+ * Run with --json or --cbor to write a machine readable inventory report of all devices to stdout instead.
  *
  * Find more information on http://www.tiepie.com/LibTiePie .
  */
@@ -9,20 +10,120 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <inttypes.h>
+#include <string.h>
 #include <libtiepie.h>
 #include "CheckStatus.h"
 #include "PrintInfo.h"
+#include "Report.h"
 #include "Utils.h"
 
+// Write an inventory report of all devices in the device list:
+static bool8_t writeInventoryReport(int format)
+{
+  Report_t report;
+  reportInit(&report, format);
+  reportBeginObject(&report, NULL);
+
+  LibraryInfo_t* libraryInfo = getLibraryInfo();
+  reportLibraryInfo(&report, "library", libraryInfo);
+  freeLibraryInfo(libraryInfo);
+
+  reportBeginArray(&report, "devices");
+
+  const uint32_t connectedDevices = LstGetCount();
+  CHECK_LAST_STATUS();
+
+  for(uint32_t index = 0; index < connectedDevices; index++)
+  {
+    reportBeginObject(&report, NULL);
+
+    uint32_t length = LstDevGetName(IDKIND_INDEX, index, NULL, 0) + 1;
+    CHECK_LAST_STATUS();
+    char* name = malloc(sizeof(char) * length);
+    LstDevGetName(IDKIND_INDEX, index, name, length);
+    CHECK_LAST_STATUS();
+    reportString(&report, "name", name);
+    free(name);
+
+    reportUInt(&report, "serialNumber", LstDevGetSerialNumber(IDKIND_INDEX, index));
+    CHECK_LAST_STATUS();
+
+    const uint32_t deviceTypes = LstDevGetTypes(IDKIND_INDEX, index);
+    CHECK_LAST_STATUS();
+    reportFlags(&report, "types", deviceTypes, DeviceTypes, DEVICETYPE_COUNT);
+
+    if(LstDevHasServer(IDKIND_INDEX, index))
+    {
+      LibTiePieHandle_t server = LstDevGetServer(IDKIND_INDEX, index);
+      CHECK_LAST_STATUS();
+
+      ServerInfo_t* serverInfo = getServerInfo(server);
+      if(serverInfo)
+      {
+        reportServerInfo(&report, "server", serverInfo);
+        freeServerInfo(serverInfo);
+      }
+
+      ObjClose(server);
+      CHECK_LAST_STATUS();
+    }
+
+    // Open every device type to report its properties:
+    reportBeginArray(&report, "instruments");
+    for(unsigned int i = 0; i < DEVICETYPE_COUNT; i++)
+    {
+      const uint32_t deviceType = 1UL << i;
+
+      if((deviceTypes & deviceType) && LstDevCanOpen(IDKIND_INDEX, index, deviceType))
+      {
+        LibTiePieHandle_t dev = LstOpenDevice(IDKIND_INDEX, index, deviceType);
+        CHECK_LAST_STATUS();
+
+        DeviceInfo_t* info = getDeviceInfo(dev);
+        if(info)
+        {
+          reportDeviceInfo(&report, NULL, info);
+          freeDeviceInfo(info);
+
+          ObjClose(dev);
+          CHECK_LAST_STATUS();
+        }
+      }
+    }
+    reportEndArray(&report);
+
+    reportEndObject(&report);
+  }
+
+  reportEndArray(&report);
+  reportEndObject(&report);
+
+  const bool8_t result = reportWrite(&report, stdout);
+  reportFree(&report);
+
+  if(!result)
+    fprintf(stderr, "Couldn't write report!" NEWLINE);
+
+  return result;
+}
+
 int main(int argc, char* argv[])
 {
   int status = EXIT_SUCCESS;
 
+  // Select report format, if any:
+  int reportFormat = -1;
+  if(argc > 1 && strcmp(argv[1], "--json") == 0)
+    reportFormat = REPORT_JSON;
+  else if(argc > 1 && strcmp(argv[1], "--cbor") == 0)
+    reportFormat = REPORT_CBOR;
+
   // Initialize library:
   LibInit();
 
   // Print library information:
-  printLibraryInfo();
+  if(reportFormat < 0)
+    printLibraryInfo();
 
   // Enable network search:
   NetSetAutoDetectEnabled(BOOL8_TRUE);
@@ -32,6 +133,17 @@ int main(int argc, char* argv[])
   LstUpdate();
   CHECK_LAST_STATUS();
 
+  if(reportFormat >= 0)
+  {
+    if(!writeInventoryReport(reportFormat))
+      status = EXIT_FAILURE;
+
+    // Exit library:
+    LibExit();
+
+    return status;
+  }
+
   // Get the number of connected devices:
   const uint32_t connectedDevices = LstGetCount();
   CHECK_LAST_STATUS();
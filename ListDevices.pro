@@ -3,7 +3,7 @@ CONFIG += console
 CONFIG -= app_bundle
 CONFIG -= qt
 
-LIBS += -ltiepie
+LIBS += -ltiepie -lpthread
 
 win32 {
   msvc*:error("The Microsoft Visual C++ Compiler is not supported, please use MinGW.")
@@ -14,18 +14,22 @@ win32 {
 }
 
 unix {
-  QMAKE_CFLAGS += -std=gnu99
+  QMAKE_CFLAGS += -std=gnu99 -pthread
   LIBS += -lm
 }
 
 HEADERS += CheckStatus.h \
+           DeviceInfo.h \
            PrintInfo.h \
+           Report.h \
            Utils.h
 
 
 SOURCES += ListDevices.c \
            CheckStatus.c \
+           DeviceInfo.c \
            PrintInfo.c \
+           Report.c \
            Utils.c
 
 # Copy files to build directory:
@@ -0,0 +1,510 @@
+/**
+ * MeasurementPlan.c
+ *
+ * This file is part of the LibTiePie programming examples.
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#include "MeasurementPlan.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+#include "UploadCache.h"
+#include "Utils.h"
+#include "WaveformFile.h"
+
+// Setting scopes:
+#define SCOPE_SCP 0
+#define SCOPE_CH 1
+#define SCOPE_GEN 2
+
+typedef struct
+{
+  const char* name;
+  double value;
+} PlanSymbol_t;
+
+typedef struct
+{
+  int scope;
+  const char* name; // Key without scope prefix.
+  const PlanSymbol_t* symbols; // NULL terminated, NULL if only numbers are allowed.
+  uint32_t invalidates; // Bit set of settings marked stale when this one changes, must come later in the apply order.
+} PlanSetting_t;
+
+#define BIT(s) (1UL << (s))
+
+static const PlanSymbol_t bools[] = {{"false", 0}, {"off", 0}, {"no", 0}, {"true", 1}, {"on", 1}, {"yes", 1}, {NULL, 0}};
+static const PlanSymbol_t measureModes[] = {{"stream", MM_STREAM}, {"block", MM_BLOCK}, {NULL, 0}};
+static const PlanSymbol_t couplings[] = {{"dcv", CK_DCV}, {"acv", CK_ACV}, {"dca", CK_DCA}, {"aca", CK_ACA}, {"ohm", CK_OHM}, {NULL, 0}};
+static const PlanSymbol_t triggerKinds[] = {{"rising", TK_RISINGEDGE}, {"falling", TK_FALLINGEDGE}, {"inwindow", TK_INWINDOW}, {"outwindow", TK_OUTWINDOW}, {"any", TK_ANYEDGE}, {NULL, 0}};
+static const PlanSymbol_t frequencyModes[] = {{"signal", FM_SIGNALFREQUENCY}, {"sample", FM_SAMPLEFREQUENCY}, {NULL, 0}};
+static const PlanSymbol_t signalTypes[] = {{"sine", ST_SINE}, {"triangle", ST_TRIANGLE}, {"square", ST_SQUARE}, {"dc", ST_DC}, {"noise", ST_NOISE}, {"arbitrary", ST_ARBITRARY}, {"pulse", ST_PULSE}, {NULL, 0}};
+
+static const PlanSetting_t settings[PS_COUNT] = {
+  [PS_SCP_MEASUREMODE] = {SCOPE_SCP, "measureMode", measureModes, BIT(PS_SCP_SAMPLEFREQUENCY) | BIT(PS_SCP_RECORDLENGTH) | BIT(PS_SCP_PRESAMPLERATIO)},
+  [PS_SCP_RESOLUTION] = {SCOPE_SCP, "resolution", NULL, BIT(PS_SCP_SAMPLEFREQUENCY) | BIT(PS_SCP_RECORDLENGTH)},
+  [PS_CH_ENABLED] = {SCOPE_CH, "enabled", bools, BIT(PS_SCP_SAMPLEFREQUENCY) | BIT(PS_SCP_RECORDLENGTH)},
+  [PS_SCP_SAMPLEFREQUENCY] = {SCOPE_SCP, "sampleFrequency", NULL, 0},
+  [PS_SCP_RECORDLENGTH] = {SCOPE_SCP, "recordLength", NULL, 0},
+  [PS_SCP_PRESAMPLERATIO] = {SCOPE_SCP, "preSampleRatio", NULL, 0},
+  [PS_SCP_TRIGGERTIMEOUT] = {SCOPE_SCP, "triggerTimeOut", NULL, 0},
+  [PS_CH_COUPLING] = {SCOPE_CH, "coupling", couplings, BIT(PS_CH_RANGE)},
+  [PS_CH_RANGE] = {SCOPE_CH, "range", NULL, 0},
+  [PS_CH_TRIGGER_ENABLED] = {SCOPE_CH, "trigger.enabled", bools, 0},
+  [PS_CH_TRIGGER_KIND] = {SCOPE_CH, "trigger.kind", triggerKinds, BIT(PS_CH_TRIGGER_LEVEL) | BIT(PS_CH_TRIGGER_HYSTERESIS)},
+  [PS_CH_TRIGGER_LEVEL] = {SCOPE_CH, "trigger.level", NULL, 0},
+  [PS_CH_TRIGGER_HYSTERESIS] = {SCOPE_CH, "trigger.hysteresis", NULL, 0},
+  [PS_GEN_SIGNALTYPE] = {SCOPE_GEN, "signalType", signalTypes, BIT(PS_GEN_FREQUENCYMODE) | BIT(PS_GEN_FREQUENCY) | BIT(PS_GEN_AMPLITUDE) | BIT(PS_GEN_OFFSET) | BIT(PS_GEN_SYMMETRY)},
+  [PS_GEN_FREQUENCYMODE] = {SCOPE_GEN, "frequencyMode", frequencyModes, BIT(PS_GEN_FREQUENCY)},
+  [PS_GEN_FREQUENCY] = {SCOPE_GEN, "frequency", NULL, 0},
+  [PS_GEN_AMPLITUDE] = {SCOPE_GEN, "amplitude", NULL, 0},
+  [PS_GEN_OFFSET] = {SCOPE_GEN, "offset", NULL, 0},
+  [PS_GEN_SYMMETRY] = {SCOPE_GEN, "symmetry", NULL, 0},
+  [PS_GEN_OUTPUTON] = {SCOPE_GEN, "outputOn", bools, 0},
+  [PS_GEN_RUNNING] = {SCOPE_GEN, "running", bools, 0}};
+
+static char* copyString(const char* s)
+{
+  const size_t length = strlen(s) + 1;
+  char* copy = malloc(length);
+  if(copy)
+    memcpy(copy, s, length);
+  return copy;
+}
+
+static char* trim(char* s)
+{
+  while(isspace((unsigned char)*s))
+    s++;
+
+  char* end = s + strlen(s);
+  while(end > s && isspace((unsigned char)end[-1]))
+    end--;
+  *end = '\0';
+
+  return s;
+}
+
+// Split "scp.x", "gen.x" or "chN.x" into setting and channel index, returns BOOL8_FALSE if unknown:
+static bool8_t parseKey(const char* key, unsigned int* setting, uint16_t* ch)
+{
+  int scope;
+  const char* name;
+
+  if(strncmp(key, "scp.", 4) == 0)
+  {
+    scope = SCOPE_SCP;
+    name = key + 4;
+    *ch = 0;
+  }
+  else if(strncmp(key, "gen.", 4) == 0)
+  {
+    scope = SCOPE_GEN;
+    name = key + 4;
+    *ch = 0;
+  }
+  else if(strncmp(key, "ch", 2) == 0 && isdigit((unsigned char)key[2]))
+  {
+    char* end;
+    const unsigned long number = strtoul(key + 2, &end, 10);
+    if(*end != '.' || number < 1 || number > PLAN_CHANNEL_MAX)
+      return BOOL8_FALSE;
+
+    scope = SCOPE_CH;
+    name = end + 1;
+    *ch = (uint16_t)(number - 1);
+  }
+  else
+    return BOOL8_FALSE;
+
+  for(unsigned int s = 0; s < PS_COUNT; s++)
+  {
+    if(settings[s].scope == scope && strcmp(settings[s].name, name) == 0)
+    {
+      *setting = s;
+      return BOOL8_TRUE;
+    }
+  }
+
+  return BOOL8_FALSE;
+}
+
+static bool8_t parseValue(const PlanSetting_t* setting, const char* text, double* value)
+{
+  if(setting->symbols)
+  {
+    for(const PlanSymbol_t* symbol = setting->symbols; symbol->name; symbol++)
+    {
+      if(strcmp(symbol->name, text) == 0)
+      {
+        *value = symbol->value;
+        return BOOL8_TRUE;
+      }
+    }
+  }
+
+  char* end;
+  *value = strtod(text, &end);
+  return end != text && *end == '\0';
+}
+
+MeasurementPlan_t* loadMeasurementPlan(const char* filename)
+{
+  FILE* file = fopen(filename, "r");
+  if(!file)
+  {
+    fprintf(stderr, "Couldn't open file: %s" NEWLINE, filename);
+    return NULL;
+  }
+
+  MeasurementPlan_t* plan = calloc(1, sizeof(MeasurementPlan_t));
+  PlanStep_t* step = NULL;
+  bool8_t ok = BOOL8_TRUE;
+  unsigned int lineNumber = 0;
+  char line[1024];
+
+  while(ok && fgets(line, sizeof(line), file))
+  {
+    lineNumber++;
+
+    char* s = trim(line);
+
+    // Skip empty lines and comments:
+    if(*s == '\0' || *s == '#' || *s == ';')
+      continue;
+
+    if(*s == '[')
+    {
+      // New step:
+      char* end = strchr(s, ']');
+      if(!end)
+      {
+        fprintf(stderr, "%s:%u Missing ]" NEWLINE, filename, lineNumber);
+        ok = BOOL8_FALSE;
+        break;
+      }
+      *end = '\0';
+
+      PlanStep_t* steps = realloc(plan->steps, sizeof(PlanStep_t) * (plan->stepCount + 1));
+      if(!steps)
+      {
+        ok = BOOL8_FALSE;
+        break;
+      }
+      plan->steps = steps;
+      step = &plan->steps[plan->stepCount++];
+      memset(step, 0, sizeof(PlanStep_t));
+      step->name = copyString(trim(s + 1));
+      continue;
+    }
+
+    char* separator = strchr(s, '=');
+    if(!separator)
+    {
+      fprintf(stderr, "%s:%u Expected key = value" NEWLINE, filename, lineNumber);
+      ok = BOOL8_FALSE;
+      break;
+    }
+    *separator = '\0';
+
+    const char* key = trim(s);
+    const char* text = trim(separator + 1);
+
+    if(!step)
+    {
+      fprintf(stderr, "%s:%u Setting outside step, add a [name] line first" NEWLINE, filename, lineNumber);
+      ok = BOOL8_FALSE;
+      break;
+    }
+
+    if(strcmp(key, "capture") == 0)
+    {
+      free(step->capture);
+      step->capture = copyString(text);
+      continue;
+    }
+
+    if(strcmp(key, "gen.data") == 0 || strcmp(key, "gen.dataInt16") == 0)
+    {
+      free(step->data);
+      step->data = copyString(text);
+      step->dataFormat = strcmp(key, "gen.data") == 0 ? WAVEFORM_FLOAT32 : WAVEFORM_INT16;
+      continue;
+    }
+
+    unsigned int setting;
+    uint16_t ch;
+    double value;
+
+    if(!parseKey(key, &setting, &ch))
+    {
+      fprintf(stderr, "%s:%u Unknown setting: %s" NEWLINE, filename, lineNumber, key);
+      ok = BOOL8_FALSE;
+    }
+    else if(!parseValue(&settings[setting], text, &value))
+    {
+      fprintf(stderr, "%s:%u Invalid value for %s: %s" NEWLINE, filename, lineNumber, key, text);
+      ok = BOOL8_FALSE;
+    }
+    else
+    {
+      step->values[setting][ch] = value;
+      step->isSet[setting][ch] = 1;
+    }
+  }
+
+  fclose(file);
+
+  if(ok && plan->stepCount == 0)
+  {
+    fprintf(stderr, "%s: No steps" NEWLINE, filename);
+    ok = BOOL8_FALSE;
+  }
+
+  if(!ok)
+  {
+    freeMeasurementPlan(plan);
+    return NULL;
+  }
+
+  return plan;
+}
+
+void freeMeasurementPlan(MeasurementPlan_t* plan)
+{
+  if(!plan)
+    return;
+
+  for(uint32_t i = 0; i < plan->stepCount; i++)
+  {
+    free(plan->steps[i].name);
+    free(plan->steps[i].capture);
+    free(plan->steps[i].data);
+  }
+  free(plan->steps);
+  free(plan);
+}
+
+void planExecutorInit(PlanExecutor_t* executor, LibTiePieHandle_t scp, LibTiePieHandle_t gen)
+{
+  memset(executor, 0, sizeof(PlanExecutor_t));
+  executor->scp = scp;
+  executor->gen = gen;
+
+  if(scp != LIBTIEPIE_HANDLE_INVALID)
+  {
+    executor->channelCount = ScpGetChannelCount(scp);
+    if(executor->channelCount > PLAN_CHANNEL_MAX)
+      executor->channelCount = PLAN_CHANNEL_MAX;
+  }
+}
+
+void planExecutorInvalidate(PlanExecutor_t* executor)
+{
+  memset(executor->states, PLAN_STATE_UNKNOWN, sizeof(executor->states));
+
+  if(executor->gen != LIBTIEPIE_HANDLE_INVALID)
+    genInvalidateDataCache(executor->gen);
+}
+
+static void callSetter(PlanExecutor_t* executor, unsigned int setting, uint16_t ch, double value)
+{
+  const LibTiePieHandle_t scp = executor->scp;
+  const LibTiePieHandle_t gen = executor->gen;
+
+  switch(setting)
+  {
+    case PS_SCP_MEASUREMODE:
+      ScpSetMeasureMode(scp, (uint32_t)value);
+      break;
+
+    case PS_SCP_RESOLUTION:
+      ScpSetResolution(scp, (uint8_t)value);
+      break;
+
+    case PS_CH_ENABLED:
+      ScpChSetEnabled(scp, ch, value != 0 ? BOOL8_TRUE : BOOL8_FALSE);
+      break;
+
+    case PS_SCP_SAMPLEFREQUENCY:
+      ScpSetSampleFrequency(scp, value);
+      break;
+
+    case PS_SCP_RECORDLENGTH:
+      ScpSetRecordLength(scp, (uint64_t)value);
+      break;
+
+    case PS_SCP_PRESAMPLERATIO:
+      ScpSetPreSampleRatio(scp, value);
+      break;
+
+    case PS_SCP_TRIGGERTIMEOUT:
+      ScpSetTriggerTimeOut(scp, value);
+      break;
+
+    case PS_CH_COUPLING:
+      ScpChSetCoupling(scp, ch, (uint64_t)value);
+      break;
+
+    case PS_CH_RANGE:
+      ScpChSetRange(scp, ch, value);
+      break;
+
+    case PS_CH_TRIGGER_ENABLED:
+      ScpChTrSetEnabled(scp, ch, value != 0 ? BOOL8_TRUE : BOOL8_FALSE);
+      break;
+
+    case PS_CH_TRIGGER_KIND:
+      ScpChTrSetKind(scp, ch, (uint64_t)value);
+      break;
+
+    case PS_CH_TRIGGER_LEVEL:
+      ScpChTrSetLevel(scp, ch, 0, value);
+      break;
+
+    case PS_CH_TRIGGER_HYSTERESIS:
+      ScpChTrSetHysteresis(scp, ch, 0, value);
+      break;
+
+    case PS_GEN_SIGNALTYPE:
+      GenSetSignalType(gen, (uint32_t)value);
+      break;
+
+    case PS_GEN_FREQUENCYMODE:
+      GenSetFrequencyMode(gen, (uint32_t)value);
+      break;
+
+    case PS_GEN_FREQUENCY:
+      GenSetFrequency(gen, value);
+      break;
+
+    case PS_GEN_AMPLITUDE:
+      GenSetAmplitude(gen, value);
+      break;
+
+    case PS_GEN_OFFSET:
+      GenSetOffset(gen, value);
+      break;
+
+    case PS_GEN_SYMMETRY:
+      GenSetSymmetry(gen, value);
+      break;
+
+    case PS_GEN_OUTPUTON:
+      GenSetOutputOn(gen, value != 0 ? BOOL8_TRUE : BOOL8_FALSE);
+      break;
+
+    case PS_GEN_RUNNING:
+      if(value != 0)
+        GenStart(gen);
+      else
+        GenStop(gen);
+      break;
+  }
+}
+
+static void uploadData(PlanExecutor_t* executor, const PlanStep_t* step)
+{
+  WaveformFile_t waveform;
+  LibTiePieStatus_t status;
+
+  if(executor->gen == LIBTIEPIE_HANDLE_INVALID)
+  {
+    fprintf(stderr, "%s: gen.data not available" NEWLINE, step->name);
+    return;
+  }
+
+  if(!openWaveformFile(&waveform, step->data, step->dataFormat))
+    return;
+
+  if(genSetDataCached(executor->gen, waveform.data, waveform.length, &status))
+  {
+    executor->callCount++;
+
+    if(status < LIBTIEPIESTATUS_SUCCESS)
+      fprintf(stderr, "%s: Setting data failed: %s" NEWLINE, step->name, LibGetStatusStr(status));
+    else
+      executor->uploadCount++;
+  }
+  else
+    executor->uploadSkipCount++;
+
+  closeWaveformFile(&waveform);
+}
+
+uint32_t applyPlanStep(PlanExecutor_t* executor, const PlanStep_t* step)
+{
+  const uint32_t callCount = executor->callCount;
+
+  for(unsigned int s = 0; s < PS_COUNT; s++)
+  {
+    const PlanSetting_t* setting = &settings[s];
+
+    // Upload data after the other generator settings, before switching the output on:
+    if(s == PS_GEN_OUTPUTON && step->data)
+      uploadData(executor, step);
+
+    const uint16_t count = setting->scope == SCOPE_CH ? PLAN_CHANNEL_MAX : 1;
+
+    for(uint16_t ch = 0; ch < count; ch++)
+    {
+      uint8_t* state = &executor->states[s][ch];
+      double* shadow = &executor->values[s][ch];
+      double value;
+
+      // Use the value of the step, or apply the previous value again if it went stale:
+      if(step->isSet[s][ch])
+        value = step->values[s][ch];
+      else if(*state == PLAN_STATE_STALE)
+        value = *shadow;
+      else
+        continue;
+
+      if(*state == PLAN_STATE_KNOWN && *shadow == value)
+      {
+        executor->skipCount++;
+        continue;
+      }
+
+      if((setting->scope == SCOPE_GEN && executor->gen == LIBTIEPIE_HANDLE_INVALID) ||
+         (setting->scope != SCOPE_GEN && executor->scp == LIBTIEPIE_HANDLE_INVALID) ||
+         (setting->scope == SCOPE_CH && ch >= executor->channelCount))
+      {
+        if(setting->scope == SCOPE_CH)
+          fprintf(stderr, "%s: ch%u.%s not available" NEWLINE, step->name, ch + 1, setting->name);
+        else
+          fprintf(stderr, "%s: %s.%s not available" NEWLINE, step->name, setting->scope == SCOPE_GEN ? "gen" : "scp", setting->name);
+        continue;
+      }
+
+      callSetter(executor, s, ch, value);
+      executor->callCount++;
+
+      if(LibGetLastStatus() < LIBTIEPIESTATUS_SUCCESS)
+      {
+        fprintf(stderr, "%s: Setting %s failed: %s" NEWLINE, step->name, setting->name, LibGetLastStatusStr());
+        *state = PLAN_STATE_UNKNOWN;
+        continue;
+      }
+
+      *shadow = value;
+      *state = PLAN_STATE_KNOWN;
+
+      // Mark dependent settings stale, channel settings only affect the same channel:
+      for(unsigned int d = s + 1; d < PS_COUNT; d++)
+      {
+        if(setting->invalidates & BIT(d))
+        {
+          uint8_t* dependent = &executor->states[d][settings[d].scope == SCOPE_CH ? ch : 0];
+          if(*dependent == PLAN_STATE_KNOWN)
+            *dependent = PLAN_STATE_STALE;
+        }
+      }
+    }
+  }
+
+  return executor->callCount - callCount;
+}
@@ -0,0 +1,107 @@
+/**
+ * MeasurementPlan.h
+ *
+ * This file is part of the LibTiePie programming examples.
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#ifndef _MEASUREMENTPLAN_H_
+#define _MEASUREMENTPLAN_H_
+
+#include <libtiepie.h>
+
+// Measurement plans: a sequence of steps with oscilloscope and generator settings and a capture spec.
+//
+// A plan file has one section per step, a step only lists the settings that differ from the previous step:
+//
+//   [name]
+//   scp.measureMode = block
+//   scp.sampleFrequency = 1e6
+//   ch1.range = 8
+//   ch1.trigger.kind = rising
+//   gen.frequency = 1e3
+//   capture = name.csv
+//
+// Arbitrary data is loaded from a raw file with gen.data (float32) or gen.dataInt16 (int16), it is uploaded after the
+// other generator settings. Uploads of data the generator already has are skipped, see UploadCache.h.
+//
+// The executor keeps a shadow copy of the device state and only calls the setters of values that changed.
+// Settings are always applied in a fixed order, e.g. coupling before range, and a setting that changes the valid
+// values of others marks them stale, so they are applied again.
+
+#define PLAN_CHANNEL_MAX 8
+
+// Settings, in the order they are applied:
+enum
+{
+  PS_SCP_MEASUREMODE,
+  PS_SCP_RESOLUTION,
+  PS_CH_ENABLED, // Affects maximum sample frequency and record length.
+  PS_SCP_SAMPLEFREQUENCY,
+  PS_SCP_RECORDLENGTH,
+  PS_SCP_PRESAMPLERATIO,
+  PS_SCP_TRIGGERTIMEOUT,
+  PS_CH_COUPLING,
+  PS_CH_RANGE,
+  PS_CH_TRIGGER_ENABLED,
+  PS_CH_TRIGGER_KIND,
+  PS_CH_TRIGGER_LEVEL,
+  PS_CH_TRIGGER_HYSTERESIS,
+  PS_GEN_SIGNALTYPE,
+  PS_GEN_FREQUENCYMODE,
+  PS_GEN_FREQUENCY,
+  PS_GEN_AMPLITUDE,
+  PS_GEN_OFFSET,
+  PS_GEN_SYMMETRY,
+  PS_GEN_OUTPUTON,
+  PS_GEN_RUNNING,
+  PS_COUNT
+};
+
+typedef struct
+{
+  char* name;
+  char* capture; // CSV file to write a block measurement to, NULL for none.
+  char* data; // Arbitrary data file, NULL for none.
+  int dataFormat; // WAVEFORM_FLOAT32 or WAVEFORM_INT16.
+  double values[PS_COUNT][PLAN_CHANNEL_MAX]; // Channel independent settings use index 0.
+  uint8_t isSet[PS_COUNT][PLAN_CHANNEL_MAX];
+} PlanStep_t;
+
+typedef struct
+{
+  uint32_t stepCount;
+  PlanStep_t* steps;
+} MeasurementPlan_t;
+
+// Shadow state of a setting:
+#define PLAN_STATE_UNKNOWN 0
+#define PLAN_STATE_KNOWN 1 // Device has the shadow value.
+#define PLAN_STATE_STALE 2 // Device may have changed it, apply the shadow value again.
+
+typedef struct
+{
+  LibTiePieHandle_t scp;
+  LibTiePieHandle_t gen;
+  uint16_t channelCount;
+  double values[PS_COUNT][PLAN_CHANNEL_MAX];
+  uint8_t states[PS_COUNT][PLAN_CHANNEL_MAX]; // PLAN_STATE_*
+  uint32_t callCount; // Setter calls issued.
+  uint32_t skipCount; // Setter calls skipped, value unchanged.
+  uint32_t uploadCount; // Arbitrary data uploads.
+  uint32_t uploadSkipCount; // Arbitrary data uploads skipped, data unchanged.
+} PlanExecutor_t;
+
+// Load a plan file, errors are printed to stderr. Returns NULL on error.
+MeasurementPlan_t* loadMeasurementPlan(const char* filename);
+void freeMeasurementPlan(MeasurementPlan_t* plan);
+
+// Executor, scp or gen may be LIBTIEPIE_HANDLE_INVALID if the plan doesn't use it:
+void planExecutorInit(PlanExecutor_t* executor, LibTiePieHandle_t scp, LibTiePieHandle_t gen);
+void planExecutorInvalidate(PlanExecutor_t* executor); // Forget shadow state, e.g. after changing the device outside the executor.
+
+// Apply the settings of a step, returns the number of setter calls issued:
+uint32_t applyPlanStep(PlanExecutor_t* executor, const PlanStep_t* step);
+
+#endif
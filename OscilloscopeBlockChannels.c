@@ -0,0 +1,295 @@
+/**
+ * OscilloscopeBlockChannels.c
+ *
+ * This example performs a block mode measurement of a subset of the channels and writes the data to OscilloscopeBlockChannels.csv.
+ * Only the requested channels are enabled and fetched, the other entries of the channel data table are NULL and get no buffer.
+ * Usage: OscilloscopeBlockChannels [channels] [record length], channels as a comma separated list, default 1 and 10 kS.
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+#include <libtiepie.h>
+#include "CheckStatus.h"
+#include "Discovery.h"
+#include "PrintInfo.h"
+#include "Utils.h"
+
+#define CHANNEL_COUNT_MAX 64
+
+// Parse a comma separated list of channel numbers, 1 based, into selected. Returns the number of channels, 0 on error:
+static uint16_t parseChannels(const char* list, bool8_t* selected)
+{
+  uint16_t count = 0;
+  const char* p = list;
+
+  memset(selected, BOOL8_FALSE, sizeof(bool8_t) * CHANNEL_COUNT_MAX);
+
+  while(*p)
+  {
+    char* end;
+    const unsigned long ch = strtoul(p, &end, 10);
+
+    if(end == p || ch < 1 || ch > CHANNEL_COUNT_MAX || (*end != ',' && *end != '\0'))
+      return 0;
+
+    if(!selected[ch - 1])
+    {
+      selected[ch - 1] = BOOL8_TRUE;
+      count++;
+    }
+
+    p = *end == ',' ? end + 1 : end;
+  }
+
+  return count;
+}
+
+int main(int argc, char* argv[])
+{
+  int status = EXIT_SUCCESS;
+  bool8_t selected[CHANNEL_COUNT_MAX];
+
+  // Check arguments:
+  const uint16_t selectedCount = parseChannels(argc > 1 ? argv[1] : "1", selected);
+  const uint64_t requestedLength = argc > 2 ? strtoull(argv[2], NULL, 10) : 10000;
+  if(selectedCount == 0 || requestedLength == 0)
+  {
+    fprintf(stderr, "Usage: %s [channels] [record length], e.g. %s 1,3 1000000" NEWLINE, argv[0], argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  // Initialize library:
+  LibInit();
+
+  // Print library information:
+  printLibraryInfo();
+
+  // Update device list, search local devices first and network devices in the background:
+  startDiscovery(DISCOVERY_LOCAL_FIRST, printDiscoveredDevice, NULL);
+
+  // Try to open an oscilloscope with block measurement support:
+  LibTiePieHandle_t scp = LIBTIEPIE_HANDLE_INVALID;
+
+  do
+  {
+    for(uint32_t index = 0; index < LstGetCount(); index++)
+    {
+      // Open by serial number, indices change when network devices are added in the background:
+      const uint32_t serialNumber = LstDevGetSerialNumber(IDKIND_INDEX, index);
+
+      if(LstDevCanOpen(IDKIND_SERIALNUMBER, serialNumber, DEVICETYPE_OSCILLOSCOPE))
+      {
+        scp = LstOpenOscilloscope(IDKIND_SERIALNUMBER, serialNumber);
+        CHECK_LAST_STATUS();
+
+        // Check for valid handle and block measurement support:
+        if(scp != LIBTIEPIE_HANDLE_INVALID && (ScpGetMeasureModes(scp) & MM_BLOCK))
+        {
+          break;
+        }
+        else
+        {
+          scp = LIBTIEPIE_HANDLE_INVALID;
+        }
+      }
+    }
+  }
+  while(scp == LIBTIEPIE_HANDLE_INVALID && waitForDiscovery()); // Not found, retry when network search completes.
+
+  if(scp != LIBTIEPIE_HANDLE_INVALID)
+  {
+    const uint16_t channelCount = ScpGetChannelCount(scp);
+    CHECK_LAST_STATUS();
+
+    // Check the requested channels:
+    uint16_t firstChannel = channelCount;
+    for(uint16_t ch = 0; ch < CHANNEL_COUNT_MAX; ch++)
+    {
+      if(selected[ch] && ch >= channelCount)
+      {
+        fprintf(stderr, "Channel %" PRIu16 " not available, the oscilloscope has %" PRIu16 " channels" NEWLINE, ch + 1, channelCount);
+        status = EXIT_FAILURE;
+      }
+      else if(selected[ch] && firstChannel == channelCount)
+      {
+        firstChannel = ch;
+      }
+    }
+
+    if(status == EXIT_SUCCESS)
+    {
+      // Set measure mode:
+      ScpSetMeasureMode(scp, MM_BLOCK);
+
+      // For all channels:
+      for(uint16_t ch = 0; ch < channelCount; ch++)
+      {
+        // Enable the requested channels only:
+        ScpChSetEnabled(scp, ch, selected[ch]);
+        CHECK_LAST_STATUS_FAST();
+
+        if(selected[ch])
+        {
+          // Set range:
+          ScpChSetRange(scp, ch, 8); // 8 V
+          CHECK_LAST_STATUS_FAST();
+
+          // Set coupling:
+          ScpChSetCoupling(scp, ch, CK_DCV); // DC Volt
+          CHECK_LAST_STATUS_FAST();
+        }
+
+        // Disable trigger source:
+        ScpChTrSetEnabled(scp, ch, BOOL8_FALSE);
+        CHECK_LAST_STATUS_FAST();
+      }
+
+      // Set sample frequency:
+      ScpSetSampleFrequency(scp, 1e6); // 1 MHz
+
+      // Set record length, limited by the oscilloscope for the enabled channels, so after enabling them:
+      const uint64_t recordLengthMax = ScpGetRecordLengthMax(scp);
+      CHECK_LAST_STATUS();
+
+      uint64_t recordLength = ScpSetRecordLength(scp, requestedLength < recordLengthMax ? requestedLength : recordLengthMax);
+      CHECK_LAST_STATUS();
+
+      // Set pre sample ratio:
+      ScpSetPreSampleRatio(scp, 0); // 0 %
+
+      // Set trigger timeout:
+      ScpSetTriggerTimeOut(scp, 100e-3); // 100 ms
+      CHECK_LAST_STATUS();
+
+      // Setup channel trigger on the first requested channel:
+      const uint16_t ch = firstChannel;
+
+      // Enable trigger source:
+      ScpChTrSetEnabled(scp, ch, BOOL8_TRUE);
+      CHECK_LAST_STATUS();
+
+      // Kind:
+      ScpChTrSetKind(scp, ch, TK_RISINGEDGE); // Rising edge
+      CHECK_LAST_STATUS();
+
+      // Level:
+      ScpChTrSetLevel(scp, ch, 0, 0.5); // 50 %
+      CHECK_LAST_STATUS();
+
+      // Hysteresis:
+      ScpChTrSetHysteresis(scp, ch, 0, 0.05); // 5 %
+      CHECK_LAST_STATUS();
+
+      // Print oscilloscope info:
+      printDeviceInfo(scp);
+
+      // Start measurement:
+      ScpStart(scp);
+      CHECK_LAST_STATUS();
+
+      // Wait for measurement to complete:
+      while(!ScpIsDataReady(scp) && !ObjIsRemoved(scp))
+      {
+        sleepMiliSeconds(10); // 10 ms delay, to save CPU time.
+      }
+
+      if(ObjIsRemoved(scp))
+      {
+        fprintf(stderr, "Device gone!" NEWLINE);
+        status = EXIT_FAILURE;
+      }
+      else if(ScpIsDataReady(scp))
+      {
+        // Create data buffers for the requested channels, NULL for the others:
+        float** channelData = calloc(channelCount, sizeof(float*));
+        uint16_t fetchCount = 0;
+        for(uint16_t ch = 0; channelData && ch < channelCount; ch++)
+        {
+          if(selected[ch] && (channelData[ch] = malloc(sizeof(float) * recordLength)))
+            fetchCount++;
+        }
+
+        if(!channelData || fetchCount < selectedCount)
+        {
+          fprintf(stderr, "Out of memory!" NEWLINE);
+          status = EXIT_FAILURE;
+        }
+        else
+        {
+          // Get the data from the scope, only the channels with a buffer are transferred:
+          const uint64_t start = getTimeNanoSeconds();
+          recordLength = ScpGetData(scp, channelData, channelCount, 0, recordLength);
+          CHECK_LAST_STATUS();
+          const double seconds = (getTimeNanoSeconds() - start) / 1e9;
+
+          printf("Fetched %" PRIu16 " of %" PRIu16 " channels: %" PRIu64 " samples each, %.3f ms, %.1f MB host memory" NEWLINE, fetchCount, channelCount, recordLength, seconds * 1e3, fetchCount * recordLength * sizeof(float) / 1e6);
+
+          // Open file with write/update permissions:
+          const char* filename = "OscilloscopeBlockChannels.csv";
+          FILE* csv = fopen(filename, "w");
+          if(csv)
+          {
+            // Write csv header:
+            fprintf(csv, "Sample");
+            for(uint16_t ch = 0; ch < channelCount; ch++)
+            {
+              if(channelData[ch])
+                fprintf(csv, ";Ch%" PRIu16, ch + 1);
+            }
+            fprintf(csv, NEWLINE);
+
+            // Write the data to csv:
+            for(uint64_t i = 0; i < recordLength; i++)
+            {
+              fprintf(csv, "%" PRIu64, i);
+              for(uint16_t ch = 0; ch < channelCount; ch++)
+              {
+                if(channelData[ch])
+                  fprintf(csv, ";%f", channelData[ch][i]);
+              }
+              fprintf(csv, NEWLINE);
+            }
+
+            printf("Data written to: %s" NEWLINE, filename);
+
+            // Close file:
+            fclose(csv);
+          }
+          else
+          {
+            fprintf(stderr, "Couldn't open file: %s" NEWLINE, filename);
+            status = EXIT_FAILURE;
+          }
+        }
+
+        // Free data buffers:
+        for(uint16_t ch = 0; channelData && ch < channelCount; ch++)
+        {
+          free(channelData[ch]);
+        }
+        free(channelData);
+      }
+    }
+
+    // Close oscilloscope:
+    ObjClose(scp);
+    CHECK_LAST_STATUS();
+  }
+  else
+  {
+    fprintf(stderr, "No oscilloscope available with block measurement support!" NEWLINE);
+    status = EXIT_FAILURE;
+  }
+
+  // Stop device discovery:
+  stopDiscovery();
+
+  // Exit library:
+  LibExit();
+
+  return status;
+}
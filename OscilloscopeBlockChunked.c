@@ -0,0 +1,326 @@
+/**
+ * OscilloscopeBlockChunked.c
+ *
+ * This example performs a block mode measurement, reads the record in chunks and writes the data to OscilloscopeBlockChunked.csv.
+ * Chunk n is written on a second thread while chunk n + 1 is transferred, using a fixed pool of chunk buffers.
+ * The memory used for the data only depends on the chunk length, not on the record length.
+ * Usage: OscilloscopeBlockChunked [record length] [chunk length], default 10 MS in chunks of 64 kS.
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include <libtiepie.h>
+#include "CheckStatus.h"
+#include "Discovery.h"
+#include "PrintInfo.h"
+#include "Queue.h"
+#include "SampleBuffer.h"
+#include "Utils.h"
+
+#define BUFFER_COUNT 3 // Chunks in flight: one being transferred, one waiting and one being written.
+
+typedef struct
+{
+  SampleBuffer_t buffer;
+  uint64_t start; // Index of the first sample in the record.
+  uint64_t length;
+} Chunk_t;
+
+typedef struct
+{
+  Queue_t filled;
+  Queue_t free; // Buffer pool.
+  uint16_t channelCount;
+  FILE* csv;
+  uint64_t exportTime; // ns
+  bool8_t writeFailed;
+} Exporter_t;
+
+static void* exportChunks(void* arg)
+{
+  Exporter_t* exporter = arg;
+  Chunk_t* chunk;
+
+  while((chunk = queuePop(&exporter->filled)))
+  {
+    const uint64_t start = getTimeNanoSeconds();
+
+    // Write the data to csv:
+    for(uint64_t i = 0; i < chunk->length; i++)
+    {
+      fprintf(exporter->csv, "%" PRIu64, chunk->start + i);
+      for(uint16_t ch = 0; ch < exporter->channelCount; ch++)
+      {
+        fprintf(exporter->csv, ";%f", chunk->buffer.channelData[ch][i]);
+      }
+      fprintf(exporter->csv, NEWLINE);
+    }
+
+    if(ferror(exporter->csv))
+      exporter->writeFailed = BOOL8_TRUE;
+
+    exporter->exportTime += getTimeNanoSeconds() - start;
+
+    // Return buffer to the pool:
+    queuePush(&exporter->free, chunk);
+  }
+
+  return NULL;
+}
+
+int main(int argc, char* argv[])
+{
+  int status = EXIT_SUCCESS;
+
+  // Check arguments:
+  const uint64_t requestedLength = argc > 1 ? strtoull(argv[1], NULL, 10) : 10000000;
+  const uint64_t chunkLength = argc > 2 ? strtoull(argv[2], NULL, 10) : 65536;
+  if(requestedLength == 0 || chunkLength == 0)
+  {
+    fprintf(stderr, "Usage: %s [record length] [chunk length]" NEWLINE, argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  // Initialize library:
+  LibInit();
+
+  // Print library information:
+  printLibraryInfo();
+
+  // Update device list, search local devices first and network devices in the background:
+  startDiscovery(DISCOVERY_LOCAL_FIRST, printDiscoveredDevice, NULL);
+
+  // Try to open an oscilloscope with block measurement support:
+  LibTiePieHandle_t scp = LIBTIEPIE_HANDLE_INVALID;
+
+  do
+  {
+    for(uint32_t index = 0; index < LstGetCount(); index++)
+    {
+      // Open by serial number, indices change when network devices are added in the background:
+      const uint32_t serialNumber = LstDevGetSerialNumber(IDKIND_INDEX, index);
+
+      if(LstDevCanOpen(IDKIND_SERIALNUMBER, serialNumber, DEVICETYPE_OSCILLOSCOPE))
+      {
+        scp = LstOpenOscilloscope(IDKIND_SERIALNUMBER, serialNumber);
+        CHECK_LAST_STATUS();
+
+        // Check for valid handle and block measurement support:
+        if(scp != LIBTIEPIE_HANDLE_INVALID && (ScpGetMeasureModes(scp) & MM_BLOCK))
+        {
+          break;
+        }
+        else
+        {
+          scp = LIBTIEPIE_HANDLE_INVALID;
+        }
+      }
+    }
+  }
+  while(scp == LIBTIEPIE_HANDLE_INVALID && waitForDiscovery()); // Not found, retry when network search completes.
+
+  if(scp != LIBTIEPIE_HANDLE_INVALID)
+  {
+    const uint16_t channelCount = ScpGetChannelCount(scp);
+    CHECK_LAST_STATUS();
+
+    // Set measure mode:
+    ScpSetMeasureMode(scp, MM_BLOCK);
+
+    // Set sample frequency:
+    ScpSetSampleFrequency(scp, 100e6); // 100 MHz
+
+    // Set record length, limited by the oscilloscope:
+    const uint64_t recordLengthMax = ScpGetRecordLengthMax(scp);
+    CHECK_LAST_STATUS();
+
+    uint64_t recordLength = ScpSetRecordLength(scp, requestedLength < recordLengthMax ? requestedLength : recordLengthMax);
+    CHECK_LAST_STATUS();
+
+    // Set pre sample ratio:
+    ScpSetPreSampleRatio(scp, 0); // 0 %
+
+    // For all channels:
+    for(uint16_t ch = 0; ch < channelCount; ch++)
+    {
+      // Enable channel to measure it:
+      ScpChSetEnabled(scp, ch, BOOL8_TRUE);
+      CHECK_LAST_STATUS_FAST();
+
+      // Set range:
+      ScpChSetRange(scp, ch, 8); // 8 V
+      CHECK_LAST_STATUS_FAST();
+
+      // Set coupling:
+      ScpChSetCoupling(scp, ch, CK_DCV); // DC Volt
+      CHECK_LAST_STATUS_FAST();
+
+      // Disable trigger source:
+      ScpChTrSetEnabled(scp, ch, BOOL8_FALSE);
+      CHECK_LAST_STATUS_FAST();
+    }
+
+    // Set trigger timeout:
+    ScpSetTriggerTimeOut(scp, 0); // Trigger immediately.
+    CHECK_LAST_STATUS();
+
+    // Print oscilloscope info:
+    printDeviceInfo(scp);
+
+    // Start measurement:
+    ScpStart(scp);
+    CHECK_LAST_STATUS();
+
+    // Wait for measurement to complete:
+    while(!ScpIsDataReady(scp) && !ObjIsRemoved(scp))
+    {
+      sleepMiliSeconds(10); // 10 ms delay, to save CPU time.
+    }
+
+    if(ObjIsRemoved(scp))
+    {
+      fprintf(stderr, "Device gone!" NEWLINE);
+      status = EXIT_FAILURE;
+    }
+    else if(ScpIsDataReady(scp))
+    {
+      Exporter_t exporter;
+      Chunk_t chunks[BUFFER_COUNT];
+      unsigned int chunkCount = 0;
+
+      exporter.channelCount = channelCount;
+      exporter.exportTime = 0;
+      exporter.writeFailed = BOOL8_FALSE;
+
+      // Create chunk buffers:
+      const bool8_t freeCreated = queueInit(&exporter.free, BUFFER_COUNT);
+      const bool8_t filledCreated = queueInit(&exporter.filled, BUFFER_COUNT);
+      for(; freeCreated && filledCreated && chunkCount < BUFFER_COUNT; chunkCount++)
+      {
+        if(!sampleBufferAlloc(&chunks[chunkCount].buffer, channelCount, chunkLength, BOOL8_FALSE))
+          break;
+        queuePush(&exporter.free, &chunks[chunkCount]);
+      }
+
+      // Open file with write/update permissions:
+      const char* filename = "OscilloscopeBlockChunked.csv";
+      FILE* csv = chunkCount == BUFFER_COUNT ? fopen(filename, "w") : NULL;
+      if(chunkCount < BUFFER_COUNT)
+      {
+        fprintf(stderr, "Out of memory!" NEWLINE);
+        status = EXIT_FAILURE;
+      }
+      else if(csv)
+      {
+        exporter.csv = csv;
+
+        // Write csv header:
+        fprintf(csv, "Sample");
+        for(uint16_t ch = 0; ch < channelCount; ch++)
+        {
+          fprintf(csv, ";Ch%" PRIu16, ch + 1);
+        }
+        fprintf(csv, NEWLINE);
+
+        pthread_t thread;
+        if(pthread_create(&thread, NULL, exportChunks, &exporter) == 0)
+        {
+          uint64_t transferTime = 0;
+          const uint64_t start = getTimeNanoSeconds();
+
+          // Get the data from the scope, chunk by chunk:
+          uint64_t index = 0;
+          while(index < recordLength)
+          {
+            Chunk_t* chunk = queuePop(&exporter.free);
+            const uint64_t requested = recordLength - index < chunkLength ? recordLength - index : chunkLength;
+
+            const uint64_t transferStart = getTimeNanoSeconds();
+            chunk->start = index;
+            const uint64_t length = ScpGetData(scp, chunk->buffer.channelData, channelCount, index, requested);
+            CHECK_LAST_STATUS_FAST();
+            transferTime += getTimeNanoSeconds() - transferStart;
+
+            chunk->length = length;
+            queuePush(&exporter.filled, chunk); // Owned by the exporter from here.
+
+            // Stop at the end of the available data:
+            if(length < requested)
+            {
+              fprintf(stderr, "Short read at sample %" PRIu64 ": %" PRIu64 " of %" PRIu64 " samples" NEWLINE, index, length, requested);
+              recordLength = index + length;
+              break;
+            }
+
+            index += length;
+          }
+
+          // Wait for the export of the last chunk:
+          queueClose(&exporter.filled);
+          pthread_join(thread, NULL);
+
+          const double seconds = (getTimeNanoSeconds() - start) / 1e9;
+
+          // Print results:
+          printf("Record length: %" PRIu64 " samples x %" PRIu16 " channels, in chunks of %" PRIu64 " samples" NEWLINE, recordLength, channelCount, chunkLength);
+          printf("Chunk buffers: %.1f MB" NEWLINE, BUFFER_COUNT * chunks[0].buffer.size / 1e6);
+          printf("Transfer: %.3f s, export: %.3f s, total: %.3f s" NEWLINE, transferTime / 1e9, exporter.exportTime / 1e9, seconds);
+
+          if(exporter.writeFailed)
+          {
+            fprintf(stderr, "Couldn't write file: %s" NEWLINE, filename);
+            status = EXIT_FAILURE;
+          }
+          else
+          {
+            printf("Data written to: %s" NEWLINE, filename);
+          }
+        }
+        else
+        {
+          fprintf(stderr, "Couldn't create export thread!" NEWLINE);
+          status = EXIT_FAILURE;
+        }
+
+        // Close file:
+        fclose(csv);
+      }
+      else
+      {
+        fprintf(stderr, "Couldn't open file: %s" NEWLINE, filename);
+        status = EXIT_FAILURE;
+      }
+
+      // Free chunk buffers:
+      for(unsigned int i = 0; i < chunkCount; i++)
+      {
+        sampleBufferFree(&chunks[i].buffer);
+      }
+      if(filledCreated)
+        queueFree(&exporter.filled);
+      if(freeCreated)
+        queueFree(&exporter.free);
+    }
+
+    // Close oscilloscope:
+    ObjClose(scp);
+    CHECK_LAST_STATUS();
+  }
+  else
+  {
+    fprintf(stderr, "No oscilloscope available with block measurement support!" NEWLINE);
+    status = EXIT_FAILURE;
+  }
+
+  // Stop device discovery:
+  stopDiscovery();
+
+  // Exit library:
+  LibExit();
+
+  return status;
+}
@@ -0,0 +1,241 @@
+/**
+ * OscilloscopeBlockHugePages.c
+ *
+ * This example compares fetching and processing a long block mode record in normal and in huge page backed buffers.
+ * The same measurement is made for both buffers, the times to get the data and to process it are printed.
+ * Processing is one sequential pass (minimum, maximum and mean) and one strided pass touching another page every sample.
+ * Usage: OscilloscopeBlockHugePages [record length], default 32 MS per channel.
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <inttypes.h>
+#include <libtiepie.h>
+#include "CheckStatus.h"
+#include "Discovery.h"
+#include "PrintInfo.h"
+#include "SampleBuffer.h"
+#include "SignalAnalysis.h"
+#include "Utils.h"
+
+#define STRIDE_MIN 4099 // Samples, just over 16 kB to touch another page every sample.
+
+static uint64_t gcd(uint64_t a, uint64_t b)
+{
+  while(b != 0)
+  {
+    const uint64_t t = a % b;
+    a = b;
+    b = t;
+  }
+
+  return a;
+}
+
+// Sum of all samples in strided order, the stride is coprime with length so every sample is visited once:
+static double sumStrided(const float* data, uint64_t length)
+{
+  uint64_t stride = STRIDE_MIN;
+  while(gcd(stride, length) != 1)
+    stride++;
+
+  double sum = 0;
+  uint64_t i = 0;
+
+  for(uint64_t n = 0; n < length; n++)
+  {
+    sum += data[i];
+    i = (i + stride) % length;
+  }
+
+  return sum;
+}
+
+int main(int argc, char* argv[])
+{
+  int status = EXIT_SUCCESS;
+
+  // Check arguments:
+  const uint64_t requestedLength = argc > 1 ? strtoull(argv[1], NULL, 10) : 32000000;
+  if(requestedLength == 0)
+  {
+    fprintf(stderr, "Usage: %s [record length]" NEWLINE, argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  // Initialize library:
+  LibInit();
+
+  // Print library information:
+  printLibraryInfo();
+
+  // Update device list, search local devices first and network devices in the background:
+  startDiscovery(DISCOVERY_LOCAL_FIRST, printDiscoveredDevice, NULL);
+
+  // Try to open an oscilloscope with block measurement support:
+  LibTiePieHandle_t scp = LIBTIEPIE_HANDLE_INVALID;
+
+  do
+  {
+    for(uint32_t index = 0; index < LstGetCount(); index++)
+    {
+      // Open by serial number, indices change when network devices are added in the background:
+      const uint32_t serialNumber = LstDevGetSerialNumber(IDKIND_INDEX, index);
+
+      if(LstDevCanOpen(IDKIND_SERIALNUMBER, serialNumber, DEVICETYPE_OSCILLOSCOPE))
+      {
+        scp = LstOpenOscilloscope(IDKIND_SERIALNUMBER, serialNumber);
+        CHECK_LAST_STATUS();
+
+        // Check for valid handle and block measurement support:
+        if(scp != LIBTIEPIE_HANDLE_INVALID && (ScpGetMeasureModes(scp) & MM_BLOCK))
+        {
+          break;
+        }
+        else
+        {
+          scp = LIBTIEPIE_HANDLE_INVALID;
+        }
+      }
+    }
+  }
+  while(scp == LIBTIEPIE_HANDLE_INVALID && waitForDiscovery()); // Not found, retry when network search completes.
+
+  if(scp != LIBTIEPIE_HANDLE_INVALID)
+  {
+    const uint16_t channelCount = ScpGetChannelCount(scp);
+    CHECK_LAST_STATUS();
+
+    // Set measure mode:
+    ScpSetMeasureMode(scp, MM_BLOCK);
+    CHECK_LAST_STATUS();
+
+    // Set sample frequency:
+    ScpSetSampleFrequency(scp, 100e6); // 100 MHz
+    CHECK_LAST_STATUS();
+
+    // Set record length, limited by the oscilloscope:
+    const uint64_t recordLengthMax = ScpGetRecordLengthMax(scp);
+    CHECK_LAST_STATUS();
+
+    const uint64_t recordLength = ScpSetRecordLength(scp, requestedLength < recordLengthMax ? requestedLength : recordLengthMax);
+    CHECK_LAST_STATUS();
+
+    // Set pre sample ratio:
+    ScpSetPreSampleRatio(scp, 0); // 0 %
+    CHECK_LAST_STATUS();
+
+    // For all channels:
+    for(uint16_t ch = 0; ch < channelCount; ch++)
+    {
+      // Enable channel to measure it:
+      ScpChSetEnabled(scp, ch, BOOL8_TRUE);
+      CHECK_LAST_STATUS();
+
+      // Set range:
+      ScpChSetRange(scp, ch, 8); // 8 V
+      CHECK_LAST_STATUS();
+
+      // Set coupling:
+      ScpChSetCoupling(scp, ch, CK_DCV); // DC Volt
+      CHECK_LAST_STATUS();
+
+      // Disable trigger source:
+      ScpChTrSetEnabled(scp, ch, BOOL8_FALSE);
+      CHECK_LAST_STATUS();
+    }
+
+    // Set trigger timeout:
+    ScpSetTriggerTimeOut(scp, 0); // Trigger immediately.
+    CHECK_LAST_STATUS();
+
+    // Print oscilloscope info:
+    printDeviceInfo(scp);
+
+    printf("Record length: %" PRIu64 " samples x %" PRIu16 " channels" NEWLINE, recordLength, channelCount);
+    printf("%18s %12s %12s %16s %16s" NEWLINE, "Pages", "Size (MB)", "Fetch (ms)", "Sequential (ms)", "Strided (ms)");
+
+    // Normal and huge page backed buffers:
+    for(int i = 0; i < 2 && status == EXIT_SUCCESS; i++)
+    {
+      SampleBuffer_t buffer;
+
+      if(!sampleBufferAlloc(&buffer, channelCount, recordLength, i == 1 ? BOOL8_TRUE : BOOL8_FALSE))
+      {
+        fprintf(stderr, "Out of memory!" NEWLINE);
+        status = EXIT_FAILURE;
+        break;
+      }
+
+      // Start measurement:
+      ScpStart(scp);
+      CHECK_LAST_STATUS();
+
+      // Wait for measurement to complete:
+      while(!ScpIsDataReady(scp) && !ObjIsRemoved(scp))
+      {
+        sleepMiliSeconds(10); // 10 ms delay, to save CPU time.
+      }
+
+      if(ObjIsRemoved(scp))
+      {
+        fprintf(stderr, "Device gone!" NEWLINE);
+        status = EXIT_FAILURE;
+      }
+      else
+      {
+        // Get data, includes mapping the fresh buffer:
+        uint64_t start = getTimeNanoSeconds();
+        const uint64_t length = ScpGetData(scp, buffer.channelData, channelCount, 0, recordLength);
+        CHECK_LAST_STATUS();
+        const double fetch = (getTimeNanoSeconds() - start) / 1e6;
+
+        // Sequential processing:
+        double check = 0;
+        start = getTimeNanoSeconds();
+        for(uint16_t ch = 0; ch < channelCount; ch++)
+        {
+          float min, max;
+          getMinMax(buffer.channelData[ch], length, &min, &max);
+          check += min + max + getMean(buffer.channelData[ch], length);
+        }
+        const double sequential = (getTimeNanoSeconds() - start) / 1e6;
+
+        // Strided processing:
+        start = getTimeNanoSeconds();
+        for(uint16_t ch = 0; ch < channelCount; ch++)
+        {
+          check += sumStrided(buffer.channelData[ch], length);
+        }
+        const double strided = (getTimeNanoSeconds() - start) / 1e6;
+
+        printf("%18s %12.1f %12.1f %16.1f %16.1f" NEWLINE, sampleBufferPagesStr(buffer.pages), buffer.size / 1e6, fetch, sequential, strided);
+
+        // Use the results, so the processing can't be optimized away:
+        if(check != check)
+          printf("Data contains NaN" NEWLINE);
+      }
+
+      sampleBufferFree(&buffer);
+    }
+
+    // Close oscilloscope:
+    ObjClose(scp);
+    CHECK_LAST_STATUS();
+  }
+  else
+  {
+    fprintf(stderr, "No oscilloscope available with block measurement support!" NEWLINE);
+    status = EXIT_FAILURE;
+  }
+
+  // Stop device discovery:
+  stopDiscovery();
+
+  // Exit library:
+  LibExit();
+
+  return status;
+}
@@ -11,6 +11,7 @@
 #include <inttypes.h>
 #include <libtiepie.h>
 #include "CheckStatus.h"
+#include "Discovery.h"
 #include "PrintInfo.h"
 #include "Utils.h"
 
@@ -24,35 +25,37 @@ int main(int argc, char* argv[])
   // Print library information:
   printLibraryInfo();
 
-  // Enable network search:
-  NetSetAutoDetectEnabled(BOOL8_TRUE);
-  CHECK_LAST_STATUS();
-
-  // Update device list:
-  LstUpdate();
-  CHECK_LAST_STATUS();
+  // Update device list, search local devices first and network devices in the background:
+  startDiscovery(DISCOVERY_LOCAL_FIRST, printDiscoveredDevice, NULL);
 
   // Try to open an oscilloscope with block measurement support:
   LibTiePieHandle_t scp = LIBTIEPIE_HANDLE_INVALID;
 
-  for(uint32_t index = 0; index < LstGetCount(); index++)
+  do
   {
-    if(LstDevCanOpen(IDKIND_INDEX, index, DEVICETYPE_OSCILLOSCOPE))
+    for(uint32_t index = 0; index < LstGetCount(); index++)
     {
-      scp = LstOpenOscilloscope(IDKIND_INDEX, index);
-      CHECK_LAST_STATUS();
+      // Open by serial number, indices change when network devices are added in the background:
+      const uint32_t serialNumber = LstDevGetSerialNumber(IDKIND_INDEX, index);
 
-      // Check for valid handle and block measurement support:
-      if(scp != LIBTIEPIE_HANDLE_INVALID && (ScpGetMeasureModes(scp) & MM_BLOCK) && (ScpGetSegmentCountMax(scp) > 1))
-      {
-        break;
-      }
-      else
+      if(LstDevCanOpen(IDKIND_SERIALNUMBER, serialNumber, DEVICETYPE_OSCILLOSCOPE))
       {
-        scp = LIBTIEPIE_HANDLE_INVALID;
+        scp = LstOpenOscilloscope(IDKIND_SERIALNUMBER, serialNumber);
+        CHECK_LAST_STATUS();
+
+        // Check for valid handle and block measurement support:
+        if(scp != LIBTIEPIE_HANDLE_INVALID && (ScpGetMeasureModes(scp) & MM_BLOCK) && (ScpGetSegmentCountMax(scp) > 1))
+        {
+          break;
+        }
+        else
+        {
+          scp = LIBTIEPIE_HANDLE_INVALID;
+        }
       }
     }
   }
+  while(scp == LIBTIEPIE_HANDLE_INVALID && waitForDiscovery()); // Not found, retry when network search completes.
 
   if(scp != LIBTIEPIE_HANDLE_INVALID)
   {
@@ -81,15 +84,15 @@ int main(int argc, char* argv[])
     {
       // Disable channels:
       ScpChSetEnabled(scp, ch, BOOL8_FALSE);
-      CHECK_LAST_STATUS();
+      CHECK_LAST_STATUS_FAST();
 
       // Set range:
       ScpChSetRange(scp, ch, 8); // 8 V
-      CHECK_LAST_STATUS();
+      CHECK_LAST_STATUS_FAST();
 
       // Set coupling:
       ScpChSetCoupling(scp, ch, CK_DCV); // DC Volt
-      CHECK_LAST_STATUS();
+      CHECK_LAST_STATUS_FAST();
     }
 
     // Enable channel 1 to measure it:
@@ -104,7 +107,7 @@ int main(int argc, char* argv[])
     for(uint16_t ch = 0; ch < channelCount; ch++)
     {
       ScpChTrSetEnabled(scp, ch, BOOL8_FALSE);
-      CHECK_LAST_STATUS();
+      CHECK_LAST_STATUS_FAST();
     }
 
     // Setup channel trigger:
@@ -224,6 +227,9 @@ int main(int argc, char* argv[])
     status = EXIT_FAILURE;
   }
 
+  // Stop device discovery:
+  stopDiscovery();
+
   // Exit library:
   LibExit();
 
@@ -0,0 +1,220 @@
+/**
+ * OscilloscopeConnectionTestMonitor.c
+ *
+ * This example repeats connection tests back to back, e.g. for a test fixture where the device under test is swapped.
+ * The oscilloscope stays open, completion is signaled by the connection test completed callback instead of polling.
+ * Only changes of the per channel results are printed, the number of tests per second is reported every 10 seconds.
+ * Usage: OscilloscopeConnectionTestMonitor [test count], default runs until Ctrl+C is pressed.
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <signal.h>
+#include <inttypes.h>
+#include <libtiepie.h>
+#include "CheckStatus.h"
+#include "Discovery.h"
+#include "Event.h"
+#include "PrintInfo.h"
+#include "Utils.h"
+
+#define REPORT_INTERVAL 10000000000ULL // 10 s in ns
+
+static volatile sig_atomic_t stop = 0;
+
+static void onInterrupt(int sig)
+{
+  (void)sig;
+  stop = 1;
+}
+
+int main(int argc, char* argv[])
+{
+  int status = EXIT_SUCCESS;
+
+  // Check arguments:
+  const uint64_t testCountMax = argc > 1 ? strtoull(argv[1], NULL, 10) : 0;
+  if(argc > 1 && testCountMax == 0)
+  {
+    fprintf(stderr, "Usage: %s [test count]" NEWLINE, argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  // Initialize library:
+  LibInit();
+
+  // Print library information:
+  printLibraryInfo();
+
+  // Update device list, search local devices first and network devices in the background:
+  startDiscovery(DISCOVERY_LOCAL_FIRST, printDiscoveredDevice, NULL);
+
+  // Try to open an oscilloscope with connection test support:
+  LibTiePieHandle_t scp = LIBTIEPIE_HANDLE_INVALID;
+
+  do
+  {
+    for(uint32_t index = 0; index < LstGetCount(); index++)
+    {
+      // Open by serial number, indices change when network devices are added in the background:
+      const uint32_t serialNumber = LstDevGetSerialNumber(IDKIND_INDEX, index);
+
+      if(LstDevCanOpen(IDKIND_SERIALNUMBER, serialNumber, DEVICETYPE_OSCILLOSCOPE))
+      {
+        scp = LstOpenOscilloscope(IDKIND_SERIALNUMBER, serialNumber);
+        CHECK_LAST_STATUS();
+
+        // Check for valid handle and connection test support:
+        if(scp != LIBTIEPIE_HANDLE_INVALID && ScpHasConnectionTest(scp))
+        {
+          break;
+        }
+        else
+        {
+          scp = LIBTIEPIE_HANDLE_INVALID;
+        }
+      }
+    }
+  }
+  while(scp == LIBTIEPIE_HANDLE_INVALID && waitForDiscovery()); // Not found, retry when network search completes.
+
+  if(scp != LIBTIEPIE_HANDLE_INVALID)
+  {
+    // Get the number of channels:
+    const uint16_t channelCount = ScpGetChannelCount(scp);
+    CHECK_LAST_STATUS();
+
+    // Enable all channels that support connection testing:
+    for(uint16_t ch = 0; ch < channelCount; ch++)
+    {
+      bool8_t b = ScpChHasConnectionTest(scp, ch);
+      CHECK_LAST_STATUS();
+      ScpChSetEnabled(scp, ch, b);
+      CHECK_LAST_STATUS();
+    }
+
+    // Create data buffers, for the current and the previous result:
+    LibTiePieTriState_t* data = malloc(sizeof(LibTiePieTriState_t) * channelCount);
+    LibTiePieTriState_t* previous = malloc(sizeof(LibTiePieTriState_t) * channelCount);
+
+    if(data && previous)
+    {
+      // Signal connection test completion:
+      Event_t completed;
+      eventInit(&completed);
+
+      ScpSetCallbackConnectionTestCompleted(scp, eventCallback, &completed);
+      CHECK_LAST_STATUS();
+
+      // Stop on Ctrl+C:
+      signal(SIGINT, onInterrupt);
+
+      printf("Monitoring connections, press Ctrl+C to stop..." NEWLINE);
+
+      uint64_t testCount = 0;
+      uint64_t timeOutCount = 0;
+      uint64_t reportCount = 0;
+      const uint64_t start = getTimeNanoSeconds();
+      uint64_t reportTime = start;
+
+      while(!stop && (testCountMax == 0 || testCount < testCountMax))
+      {
+        // Only the test started here may end the wait, drop a late callback of the previous test:
+        eventReset(&completed);
+
+        // Start connection test on current active channels:
+        ScpStartConnectionTest(scp);
+        CHECK_LAST_STATUS_FAST();
+
+        // Wait for connection test to complete, check the state if the callback is missed:
+        while(!eventWait(&completed, 100, NULL) && !stop)
+        {
+          if(ScpIsConnectionTestCompleted(scp) || ObjIsRemoved(scp))
+          {
+            timeOutCount++;
+            break;
+          }
+        }
+
+        if(ObjIsRemoved(scp))
+        {
+          fprintf(stderr, "Device gone!" NEWLINE);
+          status = EXIT_FAILURE;
+          break;
+        }
+        else if(stop && !ScpIsConnectionTestCompleted(scp))
+        {
+          break;
+        }
+
+        // Get data:
+        ScpGetConnectionTestData(scp, data, channelCount);
+        CHECK_LAST_STATUS_FAST();
+
+        const uint64_t now = getTimeNanoSeconds();
+
+        // Print changes only, all channels for the first test:
+        for(uint16_t ch = 0; ch < channelCount; ch++)
+        {
+          if(testCount == 0 || data[ch] != previous[ch])
+          {
+            printf("%10.3f s: Ch%" PRIu16 " = %s" NEWLINE, (now - start) / 1e9, ch + 1, triStateToStr(data[ch]));
+          }
+        }
+
+        memcpy(previous, data, sizeof(LibTiePieTriState_t) * channelCount);
+        testCount++;
+
+        if(now - reportTime >= REPORT_INTERVAL)
+        {
+          printf("%10.3f s: %.1f tests/s" NEWLINE, (now - start) / 1e9, (testCount - reportCount) / ((now - reportTime) / 1e9));
+          reportCount = testCount;
+          reportTime = now;
+        }
+      }
+
+      const double seconds = (getTimeNanoSeconds() - start) / 1e9;
+
+      signal(SIGINT, SIG_DFL);
+
+      ScpSetCallbackConnectionTestCompleted(scp, NULL, NULL);
+      CHECK_LAST_STATUS();
+
+      // Print results:
+      printf("%" PRIu64 " tests in %.3f s, %.1f tests/s" NEWLINE, testCount, seconds, seconds > 0 ? testCount / seconds : 0);
+      if(timeOutCount > 0)
+        printf("Connection test completed callback missed %" PRIu64 " time(s), polled instead" NEWLINE, timeOutCount);
+
+      eventFree(&completed);
+    }
+    else
+    {
+      fprintf(stderr, "Out of memory!" NEWLINE);
+      status = EXIT_FAILURE;
+    }
+
+    // Free data buffers:
+    free(previous);
+    free(data);
+
+    // Close oscilloscope:
+    ObjClose(scp);
+    CHECK_LAST_STATUS();
+  }
+  else
+  {
+    fprintf(stderr, "No oscilloscope available with connection test support!" NEWLINE);
+    status = EXIT_FAILURE;
+  }
+
+  // Stop device discovery:
+  stopDiscovery();
+
+  // Exit library:
+  LibExit();
+
+  return status;
+}
@@ -0,0 +1,219 @@
+/**
+ * OscilloscopeConnectionTestMulti.c
+ *
+ * This example performs a connection test on all oscilloscopes with connection test support at once.
+ * The results are collected as each oscilloscope completes, so the total time is that of the slowest oscilloscope.
+ * The results are printed as one table, with a row per oscilloscope and a column per channel.
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <inttypes.h>
+#include <libtiepie.h>
+#include "CheckStatus.h"
+#include "Discovery.h"
+#include "Event.h"
+#include "PrintInfo.h"
+#include "Utils.h"
+
+typedef struct
+{
+  LibTiePieHandle_t scp;
+  uint32_t serialNumber;
+  uint16_t channelCount;
+  LibTiePieTriState_t* data;
+  bool8_t done;
+  uint64_t duration; // ns
+} ConnectionTest_t;
+
+int main(int argc, char* argv[])
+{
+  int status = EXIT_SUCCESS;
+
+  // Initialize library:
+  LibInit();
+
+  // Print library information:
+  printLibraryInfo();
+
+  // Update device list, local and network devices:
+  startDiscovery(DISCOVERY_BLOCKING, NULL, NULL);
+
+  // Open all oscilloscopes with connection test support:
+  const uint32_t deviceCount = LstGetCount();
+  ConnectionTest_t* tests = calloc(deviceCount > 0 ? deviceCount : 1, sizeof(ConnectionTest_t));
+  uint32_t testCount = 0;
+  uint16_t channelCountMax = 0;
+
+  for(uint32_t index = 0; index < deviceCount; index++)
+  {
+    if(LstDevCanOpen(IDKIND_INDEX, index, DEVICETYPE_OSCILLOSCOPE))
+    {
+      LibTiePieHandle_t scp = LstOpenOscilloscope(IDKIND_INDEX, index);
+      CHECK_LAST_STATUS();
+
+      // Check for valid handle and connection test support:
+      if(scp != LIBTIEPIE_HANDLE_INVALID && ScpHasConnectionTest(scp))
+      {
+        ConnectionTest_t* test = &tests[testCount++];
+
+        test->scp = scp;
+        test->serialNumber = DevGetSerialNumber(scp);
+        CHECK_LAST_STATUS();
+
+        // Get the number of channels:
+        test->channelCount = ScpGetChannelCount(scp);
+        CHECK_LAST_STATUS();
+
+        if(test->channelCount > channelCountMax)
+          channelCountMax = test->channelCount;
+
+        // Create data buffer:
+        test->data = malloc(sizeof(LibTiePieTriState_t) * test->channelCount);
+
+        // Enable all channels that support connection testing:
+        for(uint16_t ch = 0; ch < test->channelCount; ch++)
+        {
+          bool8_t b = ScpChHasConnectionTest(scp, ch);
+          CHECK_LAST_STATUS();
+          ScpChSetEnabled(scp, ch, b);
+          CHECK_LAST_STATUS();
+        }
+      }
+      else if(scp != LIBTIEPIE_HANDLE_INVALID)
+      {
+        ObjClose(scp);
+        CHECK_LAST_STATUS();
+      }
+    }
+  }
+
+  if(testCount > 0)
+  {
+    // One event for all oscilloscopes, signaled by each connection test completed callback:
+    Event_t completed;
+    eventInit(&completed);
+
+    for(uint32_t i = 0; i < testCount; i++)
+    {
+      ScpSetCallbackConnectionTestCompleted(tests[i].scp, eventCallback, &completed);
+      CHECK_LAST_STATUS();
+    }
+
+    printf("Testing %" PRIu32 " oscilloscope(s)..." NEWLINE, testCount);
+
+    // Start connection test on all oscilloscopes:
+    const uint64_t start = getTimeNanoSeconds();
+
+    for(uint32_t i = 0; i < testCount; i++)
+    {
+      ScpStartConnectionTest(tests[i].scp);
+      CHECK_LAST_STATUS();
+    }
+
+    // Collect results as each oscilloscope completes:
+    uint32_t doneCount = 0;
+
+    while(doneCount < testCount)
+    {
+      // Wait for a completion, check all oscilloscopes at least every 100 ms in case a callback is missed:
+      eventWait(&completed, 100, NULL);
+
+      const uint64_t now = getTimeNanoSeconds();
+
+      for(uint32_t i = 0; i < testCount; i++)
+      {
+        ConnectionTest_t* test = &tests[i];
+
+        if(test->done)
+          continue;
+
+        if(ObjIsRemoved(test->scp))
+        {
+          fprintf(stderr, "Device s/n %" PRIu32 " gone!" NEWLINE, test->serialNumber);
+          status = EXIT_FAILURE;
+
+          // No result:
+          free(test->data);
+          test->data = NULL;
+        }
+        else if(ScpIsConnectionTestCompleted(test->scp))
+        {
+          // Get data:
+          if(test->data)
+          {
+            ScpGetConnectionTestData(test->scp, test->data, test->channelCount);
+            CHECK_LAST_STATUS();
+          }
+        }
+        else
+        {
+          continue;
+        }
+
+        test->duration = now - start;
+        test->done = BOOL8_TRUE;
+        doneCount++;
+      }
+    }
+
+    const double seconds = (getTimeNanoSeconds() - start) / 1e9;
+
+    for(uint32_t i = 0; i < testCount; i++)
+    {
+      ScpSetCallbackConnectionTestCompleted(tests[i].scp, NULL, NULL);
+      CHECK_LAST_STATUS();
+    }
+
+    eventFree(&completed);
+
+    // Print results:
+    printf("Connection test result:" NEWLINE);
+    printf("%12s %10s", "Serial", "Time (ms)");
+    for(uint16_t ch = 0; ch < channelCountMax; ch++)
+    {
+      printf("  Ch%-7" PRIu16, ch + 1);
+    }
+    printf(NEWLINE);
+
+    for(uint32_t i = 0; i < testCount; i++)
+    {
+      const ConnectionTest_t* test = &tests[i];
+
+      printf("%12" PRIu32 " %10.1f", test->serialNumber, test->duration / 1e6);
+      for(uint16_t ch = 0; ch < test->channelCount; ch++)
+      {
+        printf("  %-9s", test->data ? triStateToStr(test->data[ch]) : "-");
+      }
+      printf(NEWLINE);
+    }
+
+    printf("Total time: %.1f ms" NEWLINE, seconds * 1e3);
+
+    // Close oscilloscopes and free data buffers:
+    for(uint32_t i = 0; i < testCount; i++)
+    {
+      ObjClose(tests[i].scp);
+      CHECK_LAST_STATUS();
+
+      free(tests[i].data);
+    }
+  }
+  else
+  {
+    fprintf(stderr, "No oscilloscope available with connection test support!" NEWLINE);
+    status = EXIT_FAILURE;
+  }
+
+  free(tests);
+
+  // Stop device discovery:
+  stopDiscovery();
+
+  // Exit library:
+  LibExit();
+
+  return status;
+}
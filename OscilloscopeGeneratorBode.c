@@ -0,0 +1,386 @@
+/**
+ * OscilloscopeGeneratorBode.c
+ *
+ * This example measures a frequency response (Bode plot) with the generator and the oscilloscope of one device.
+ * Connect the generator output to channel 1, the reference, and to the input of the device under test.
+ * Connect the output of the device under test to the other channels.
+ * The generator sweeps a sine, each point is measured triggered on "Generator new period".
+ * Point n is analyzed on a second thread while point n + 1 is being set up and measured.
+ * Gain and phase per channel are written to OscilloscopeGeneratorBode.csv.
+ * Usage: OscilloscopeGeneratorBode [start Hz] [stop Hz] [points], default 100 Hz to 100 kHz in 61 points.
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include <libtiepie.h>
+#include "CheckStatus.h"
+#include "Discovery.h"
+#include "PrintInfo.h"
+#include "Queue.h"
+#include "SignalAnalysis.h"
+#include "Sweep.h"
+#include "Utils.h"
+
+#define SAMPLES_PER_PERIOD 64
+#define PERIOD_COUNT 16 // Periods per measurement.
+#define RECORD_LENGTH_MAX (SAMPLES_PER_PERIOD * PERIOD_COUNT + 1) // Sample frequencies are rounded, allow one extra sample.
+#define BUFFER_COUNT 3 // Measurements in flight: one being measured, one waiting and one being analyzed.
+
+typedef struct
+{
+  uint32_t point;
+  double frequency; // Actual generator frequency.
+  double sampleFrequency; // Actual oscilloscope sample frequency.
+  uint64_t length;
+  float** channelData;
+} Measurement_t;
+
+typedef struct
+{
+  Queue_t measured;
+  Queue_t free; // Buffer pool.
+  uint16_t channelCount;
+  double* gain; // [point * channelCount + ch]
+  double* phase;
+  double* frequency;
+  uint64_t analysisTime; // ns
+} Analyzer_t;
+
+static void* analyze(void* arg)
+{
+  Analyzer_t* analyzer = arg;
+  Measurement_t* measurement;
+
+  while((measurement = queuePop(&analyzer->measured)))
+  {
+    const uint64_t start = getTimeNanoSeconds();
+    const double frequency = measurement->frequency / measurement->sampleFrequency; // Cycles per sample.
+    const Complex_t reference = dftBinHann(measurement->channelData[0], measurement->length, frequency);
+
+    for(uint16_t ch = 1; ch < analyzer->channelCount; ch++)
+    {
+      const uint32_t index = measurement->point * analyzer->channelCount + ch;
+      getGainPhase(dftBinHann(measurement->channelData[ch], measurement->length, frequency), reference, &analyzer->gain[index], &analyzer->phase[index]);
+    }
+    analyzer->frequency[measurement->point] = measurement->frequency;
+    analyzer->analysisTime += getTimeNanoSeconds() - start;
+
+    // Return buffer to the pool:
+    queuePush(&analyzer->free, measurement);
+  }
+
+  return NULL;
+}
+
+int main(int argc, char* argv[])
+{
+  int status = EXIT_SUCCESS;
+  Sweep_t sweep;
+
+  // Create sweep:
+  if(!createSweep(&sweep, SWEEP_LOG, argc > 3 ? (uint32_t)strtoul(argv[3], NULL, 10) : 61, argc > 1 ? atof(argv[1]) : 100, argc > 2 ? atof(argv[2]) : 100e3, 1, 1, 0))
+  {
+    fprintf(stderr, "Usage: %s [start Hz] [stop Hz] [points]" NEWLINE, argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  // Initialize library:
+  LibInit();
+
+  // Print library information:
+  printLibraryInfo();
+
+  // Update device list, search local devices first and network devices in the background:
+  startDiscovery(DISCOVERY_LOCAL_FIRST, printDiscoveredDevice, NULL);
+
+  // Try to open an oscilloscope with block measurement support and a generator in the same device:
+  LibTiePieHandle_t scp = LIBTIEPIE_HANDLE_INVALID;
+  LibTiePieHandle_t gen = LIBTIEPIE_HANDLE_INVALID;
+
+  do
+  {
+    for(uint32_t index = 0; index < LstGetCount(); index++)
+    {
+      // Open by serial number, indices change when network devices are added in the background:
+      const uint32_t serialNumber = LstDevGetSerialNumber(IDKIND_INDEX, index);
+
+      if(LstDevCanOpen(IDKIND_SERIALNUMBER, serialNumber, DEVICETYPE_OSCILLOSCOPE) && LstDevCanOpen(IDKIND_SERIALNUMBER, serialNumber, DEVICETYPE_GENERATOR))
+      {
+        scp = LstOpenOscilloscope(IDKIND_SERIALNUMBER, serialNumber);
+        CHECK_LAST_STATUS();
+
+        // Check for valid handle, block measurement support and a reference channel:
+        if(scp != LIBTIEPIE_HANDLE_INVALID && (ScpGetMeasureModes(scp) & MM_BLOCK) && ScpGetChannelCount(scp) >= 2)
+        {
+          gen = LstOpenGenerator(IDKIND_SERIALNUMBER, serialNumber);
+          CHECK_LAST_STATUS();
+
+          // Check for valid handle:
+          if(gen != LIBTIEPIE_HANDLE_INVALID)
+          {
+            break;
+          }
+
+          // No generator, close oscilloscope:
+          ObjClose(scp);
+          CHECK_LAST_STATUS();
+        }
+
+        scp = LIBTIEPIE_HANDLE_INVALID;
+      }
+    }
+  }
+  while(scp == LIBTIEPIE_HANDLE_INVALID && waitForDiscovery()); // Not found, retry when network search completes.
+
+  if(scp != LIBTIEPIE_HANDLE_INVALID && gen != LIBTIEPIE_HANDLE_INVALID)
+  {
+    // Oscilloscope settings:
+
+    const uint16_t channelCount = ScpGetChannelCount(scp);
+    CHECK_LAST_STATUS();
+
+    // Set measure mode:
+    ScpSetMeasureMode(scp, MM_BLOCK);
+
+    // Set pre sample ratio:
+    ScpSetPreSampleRatio(scp, 0); // 0 %
+
+    // For all channels:
+    for(uint16_t ch = 0; ch < channelCount; ch++)
+    {
+      // Enable channel to measure it:
+      ScpChSetEnabled(scp, ch, BOOL8_TRUE);
+      CHECK_LAST_STATUS_FAST();
+
+      // Set range:
+      ScpChSetRange(scp, ch, 8); // 8 V
+      CHECK_LAST_STATUS_FAST();
+
+      // Set coupling:
+      ScpChSetCoupling(scp, ch, CK_DCV); // DC Volt
+      CHECK_LAST_STATUS_FAST();
+
+      // Disable channel trigger source:
+      ScpChTrSetEnabled(scp, ch, BOOL8_FALSE);
+      CHECK_LAST_STATUS_FAST();
+    }
+
+    // Set trigger timeout:
+    ScpSetTriggerTimeOut(scp, 1); // 1 s
+    CHECK_LAST_STATUS();
+
+    // Locate trigger input:
+    const uint16_t index = DevTrGetInputIndexById(scp, TIID_GENERATOR_NEW_PERIOD);
+    CHECK_LAST_STATUS();
+
+    if(index != LIBTIEPIE_TRIGGERIO_INDEX_INVALID)
+    {
+      // Enable trigger input:
+      DevTrInSetEnabled(scp, index, BOOL8_TRUE);
+      CHECK_LAST_STATUS();
+    }
+
+    // Generator settings:
+
+    // Set signal type:
+    GenSetSignalType(gen, ST_SINE);
+    CHECK_LAST_STATUS();
+
+    // Set frequency:
+    GenSetFrequency(gen, sweep.points[0].frequency);
+    CHECK_LAST_STATUS();
+
+    // Set amplitude:
+    GenSetAmplitude(gen, sweep.points[0].amplitude); // 1 V
+    CHECK_LAST_STATUS();
+
+    // Set offset:
+    GenSetOffset(gen, 0); // 0 V
+    CHECK_LAST_STATUS();
+
+    // Enable output:
+    GenSetOutputOn(gen, BOOL8_TRUE);
+    CHECK_LAST_STATUS();
+
+    // Print oscilloscope info:
+    printDeviceInfo(scp);
+
+    // Print generator info:
+    printDeviceInfo(gen);
+
+    // Start signal generation:
+    GenStart(gen);
+    CHECK_LAST_STATUS();
+
+    // Create buffer pool and results:
+    const double sampleFrequencyMax = ScpGetSampleFrequencyMax(scp);
+    Measurement_t measurements[BUFFER_COUNT];
+    Analyzer_t analyzer;
+
+    analyzer.channelCount = channelCount;
+    analyzer.gain = calloc((size_t)sweep.count * channelCount, sizeof(double));
+    analyzer.phase = calloc((size_t)sweep.count * channelCount, sizeof(double));
+    analyzer.frequency = calloc(sweep.count, sizeof(double));
+    analyzer.analysisTime = 0;
+    queueInit(&analyzer.measured, BUFFER_COUNT);
+    queueInit(&analyzer.free, BUFFER_COUNT);
+
+    for(unsigned int i = 0; i < BUFFER_COUNT; i++)
+    {
+      measurements[i].channelData = malloc(sizeof(float*) * channelCount);
+      for(uint16_t ch = 0; ch < channelCount; ch++)
+      {
+        measurements[i].channelData[ch] = malloc(sizeof(float) * RECORD_LENGTH_MAX);
+      }
+      queuePush(&analyzer.free, &measurements[i]);
+    }
+
+    // Start analysis thread:
+    pthread_t thread;
+    pthread_create(&thread, NULL, analyze, &analyzer);
+
+    const uint64_t start = getTimeNanoSeconds();
+    uint32_t pointCount = 0;
+
+    for(uint32_t i = 0; i < sweep.count && status == EXIT_SUCCESS; i++)
+    {
+      // Wait for a free buffer, only blocks when the analysis can't keep up:
+      Measurement_t* measurement = queuePop(&analyzer.free);
+
+      // Set frequency:
+      measurement->point = i;
+      measurement->frequency = GenSetFrequency(gen, sweep.points[i].frequency);
+      CHECK_LAST_STATUS_FAST();
+
+      // Set sample frequency, SAMPLES_PER_PERIOD or as high as possible:
+      measurement->sampleFrequency = ScpSetSampleFrequency(scp, fmin(measurement->frequency * SAMPLES_PER_PERIOD, sampleFrequencyMax));
+      CHECK_LAST_STATUS_FAST();
+
+      // Set record length, a whole number of periods:
+      uint64_t recordLength = (uint64_t)llround(measurement->sampleFrequency / measurement->frequency * PERIOD_COUNT);
+      if(recordLength > RECORD_LENGTH_MAX)
+        recordLength = RECORD_LENGTH_MAX;
+      recordLength = ScpSetRecordLength(scp, recordLength);
+      CHECK_LAST_STATUS_FAST();
+
+      // Start measurement:
+      ScpStart(scp);
+      CHECK_LAST_STATUS_FAST();
+
+      // Wait for measurement to complete:
+      while(!ScpIsDataReady(scp) && !ObjIsRemoved(scp))
+      {
+        sleepMiliSeconds(1); // 1 ms delay, to save CPU time.
+      }
+
+      if(ObjIsRemoved(scp))
+      {
+        fprintf(stderr, "Device gone!" NEWLINE);
+        queuePush(&analyzer.free, measurement);
+        status = EXIT_FAILURE;
+        break;
+      }
+
+      // Get the data from the scope:
+      measurement->length = ScpGetData(scp, measurement->channelData, channelCount, 0, recordLength);
+      CHECK_LAST_STATUS_FAST();
+
+      // Hand over to the analysis thread:
+      queuePush(&analyzer.measured, measurement);
+      pointCount++;
+    }
+
+    // Wait for the analysis to complete:
+    queueClose(&analyzer.measured);
+    pthread_join(thread, NULL);
+
+    const double seconds = (getTimeNanoSeconds() - start) / 1e9;
+    printf("%" PRIu32 " points in %.3f s: %.1f points/s, analysis %.3f s" NEWLINE, pointCount, seconds, pointCount / seconds, analyzer.analysisTime / 1e9);
+
+    // Stop generator:
+    GenStop(gen);
+    CHECK_LAST_STATUS();
+
+    // Disable output:
+    GenSetOutputOn(gen, BOOL8_FALSE);
+    CHECK_LAST_STATUS();
+
+    // Open file with write/update permissions:
+    const char* filename = "OscilloscopeGeneratorBode.csv";
+    FILE* csv = fopen(filename, "w");
+    if(csv)
+    {
+      // Write csv header:
+      fprintf(csv, "Frequency");
+      for(uint16_t ch = 1; ch < channelCount; ch++)
+      {
+        fprintf(csv, ";Ch%" PRIu16 " gain (dB);Ch%" PRIu16 " phase (deg)", ch + 1, ch + 1);
+      }
+      fprintf(csv, NEWLINE);
+
+      // Write the results to csv:
+      for(uint32_t i = 0; i < pointCount; i++)
+      {
+        fprintf(csv, "%f", analyzer.frequency[i]);
+        for(uint16_t ch = 1; ch < channelCount; ch++)
+        {
+          fprintf(csv, ";%f;%f", analyzer.gain[i * channelCount + ch], analyzer.phase[i * channelCount + ch]);
+        }
+        fprintf(csv, NEWLINE);
+      }
+
+      printf("Data written to: %s" NEWLINE, filename);
+
+      // Close file:
+      fclose(csv);
+    }
+    else
+    {
+      fprintf(stderr, "Couldn't open file: %s" NEWLINE, filename);
+      status = EXIT_FAILURE;
+    }
+
+    // Free buffers:
+    for(unsigned int i = 0; i < BUFFER_COUNT; i++)
+    {
+      for(uint16_t ch = 0; ch < channelCount; ch++)
+      {
+        free(measurements[i].channelData[ch]);
+      }
+      free(measurements[i].channelData);
+    }
+    queueFree(&analyzer.free);
+    queueFree(&analyzer.measured);
+    free(analyzer.frequency);
+    free(analyzer.phase);
+    free(analyzer.gain);
+
+    // Close oscilloscope:
+    ObjClose(scp);
+    CHECK_LAST_STATUS();
+
+    // Close generator:
+    ObjClose(gen);
+    CHECK_LAST_STATUS();
+  }
+  else
+  {
+    fprintf(stderr, "No oscilloscope available with block measurement support and two channels or generator available in the same unit!" NEWLINE);
+    status = EXIT_FAILURE;
+  }
+
+  // Stop device discovery:
+  stopDiscovery();
+
+  // Exit library:
+  LibExit();
+
+  freeSweep(&sweep);
+
+  return status;
+}
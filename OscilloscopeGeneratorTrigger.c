@@ -13,6 +13,7 @@
 #include <inttypes.h>
 #include <libtiepie.h>
 #include "CheckStatus.h"
+#include "Discovery.h"
 #include "PrintInfo.h"
 #include "Utils.h"
 
@@ -26,37 +27,39 @@ int main(int argc, char* argv[])
   // Print library information:
   printLibraryInfo();
 
-  // Enable network search:
-  NetSetAutoDetectEnabled(BOOL8_TRUE);
-  CHECK_LAST_STATUS();
-
-  // Update device list:
-  LstUpdate();
-  CHECK_LAST_STATUS();
+  // Update device list, search local devices first and network devices in the background:
+  startDiscovery(DISCOVERY_LOCAL_FIRST, printDiscoveredDevice, NULL);
 
   // Try to open an oscilloscope with block measurement support and a generator in the same device:
   LibTiePieHandle_t scp = LIBTIEPIE_HANDLE_INVALID;
   LibTiePieHandle_t gen = LIBTIEPIE_HANDLE_INVALID;
 
-  for(uint32_t index = 0; index < LstGetCount(); index++)
+  do
   {
-    if(LstDevCanOpen(IDKIND_INDEX, index, DEVICETYPE_OSCILLOSCOPE) && LstDevCanOpen(IDKIND_INDEX, index, DEVICETYPE_GENERATOR))
+    for(uint32_t index = 0; index < LstGetCount(); index++)
     {
-      scp = LstOpenOscilloscope(IDKIND_INDEX, index);
-      CHECK_LAST_STATUS();
+      // Open by serial number, indices change when network devices are added in the background:
+      const uint32_t serialNumber = LstDevGetSerialNumber(IDKIND_INDEX, index);
 
-      // Check for valid handle and block measurement support:
-      if(scp != LIBTIEPIE_HANDLE_INVALID && (ScpGetMeasureModes(scp) & MM_BLOCK))
-      {
-        gen = LstOpenGenerator(IDKIND_INDEX, index);
-        break;
-      }
-      else
+      if(LstDevCanOpen(IDKIND_SERIALNUMBER, serialNumber, DEVICETYPE_OSCILLOSCOPE) && LstDevCanOpen(IDKIND_SERIALNUMBER, serialNumber, DEVICETYPE_GENERATOR))
       {
-        scp = LIBTIEPIE_HANDLE_INVALID;
+        scp = LstOpenOscilloscope(IDKIND_SERIALNUMBER, serialNumber);
+        CHECK_LAST_STATUS();
+
+        // Check for valid handle and block measurement support:
+        if(scp != LIBTIEPIE_HANDLE_INVALID && (ScpGetMeasureModes(scp) & MM_BLOCK))
+        {
+          gen = LstOpenGenerator(IDKIND_SERIALNUMBER, serialNumber);
+          break;
+        }
+        else
+        {
+          scp = LIBTIEPIE_HANDLE_INVALID;
+        }
       }
     }
   }
+  while(scp == LIBTIEPIE_HANDLE_INVALID && waitForDiscovery()); // Not found, retry when network search completes.
 
   if(scp != LIBTIEPIE_HANDLE_INVALID && gen != LIBTIEPIE_HANDLE_INVALID)
   {
@@ -83,15 +86,15 @@ int main(int argc, char* argv[])
     {
       // Enable channel to measure it:
       ScpChSetEnabled(scp, ch, BOOL8_TRUE);
-      CHECK_LAST_STATUS();
+      CHECK_LAST_STATUS_FAST();
 
       // Set range:
       ScpChSetRange(scp, ch, 8); // 8 V
-      CHECK_LAST_STATUS();
+      CHECK_LAST_STATUS_FAST();
 
       // Set coupling:
       ScpChSetCoupling(scp, ch, CK_DCV); // DC Volt
-      CHECK_LAST_STATUS();
+      CHECK_LAST_STATUS_FAST();
     }
 
     // Set trigger timeout:
@@ -102,7 +105,7 @@ int main(int argc, char* argv[])
     for(uint16_t ch = 0; ch < channelCount; ch++)
     {
       ScpChTrSetEnabled(scp, ch, BOOL8_FALSE);
-      CHECK_LAST_STATUS();
+      CHECK_LAST_STATUS_FAST();
     }
 
     // Locate trigger input:
@@ -242,6 +245,9 @@ int main(int argc, char* argv[])
     status = EXIT_FAILURE;
   }
 
+  // Stop device discovery:
+  stopDiscovery();
+
   // Exit library:
   LibExit();
 
@@ -0,0 +1,211 @@
+/**
+ * OscilloscopeMeasurementPlan.c
+ *
+ * This example executes a measurement plan, a sequence of oscilloscope and generator settings with a capture per step.
+ * Only the settings that differ from the previous step are sent to the device.
+ * The plan file is given as argument, it defaults to OscilloscopeMeasurementPlan.txt.
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <inttypes.h>
+#include <libtiepie.h>
+#include "CheckStatus.h"
+#include "Discovery.h"
+#include "MeasurementPlan.h"
+#include "PrintInfo.h"
+#include "UploadCache.h"
+#include "Utils.h"
+
+// Perform a measurement and write the data to a csv file:
+static bool8_t capture(LibTiePieHandle_t scp, const char* filename)
+{
+  const uint16_t channelCount = ScpGetChannelCount(scp);
+  uint64_t recordLength = ScpGetRecordLength(scp);
+  bool8_t result = BOOL8_FALSE;
+
+  // Start measurement:
+  ScpStart(scp);
+  CHECK_LAST_STATUS();
+
+  // Wait for measurement to complete:
+  while(!ScpIsDataReady(scp) && !ObjIsRemoved(scp))
+  {
+    sleepMiliSeconds(1); // 1 ms delay, to save CPU time.
+  }
+
+  if(ObjIsRemoved(scp))
+  {
+    fprintf(stderr, "Device gone!" NEWLINE);
+    return BOOL8_FALSE;
+  }
+
+  // Create data buffers, disabled channels are skipped:
+  float** channelData = malloc(sizeof(float*) * channelCount);
+  for(uint16_t ch = 0; ch < channelCount; ch++)
+  {
+    channelData[ch] = ScpChGetEnabled(scp, ch) ? malloc(sizeof(float) * recordLength) : NULL;
+  }
+
+  // Get the data from the scope:
+  recordLength = ScpGetData(scp, channelData, channelCount, 0, recordLength);
+  CHECK_LAST_STATUS();
+
+  // Stop measurement, needed in stream mode:
+  ScpStop(scp);
+
+  // Open file with write/update permissions:
+  FILE* csv = fopen(filename, "w");
+  if(csv)
+  {
+    // Write csv header:
+    fprintf(csv, "Sample");
+    for(uint16_t ch = 0; ch < channelCount; ch++)
+    {
+      if(channelData[ch])
+        fprintf(csv, ";Ch%" PRIu16, ch + 1);
+    }
+    fprintf(csv, NEWLINE);
+
+    // Write the data to csv:
+    for(uint64_t i = 0; i < recordLength; i++)
+    {
+      fprintf(csv, "%" PRIu64, i);
+      for(uint16_t ch = 0; ch < channelCount; ch++)
+      {
+        if(channelData[ch])
+          fprintf(csv, ";%f", channelData[ch][i]);
+      }
+      fprintf(csv, NEWLINE);
+    }
+
+    printf("  Data written to: %s" NEWLINE, filename);
+
+    // Close file:
+    fclose(csv);
+    result = BOOL8_TRUE;
+  }
+  else
+  {
+    fprintf(stderr, "Couldn't open file: %s" NEWLINE, filename);
+  }
+
+  // Free data buffers:
+  for(uint16_t ch = 0; ch < channelCount; ch++)
+  {
+    free(channelData[ch]);
+  }
+  free(channelData);
+
+  return result;
+}
+
+int main(int argc, char* argv[])
+{
+  int status = EXIT_SUCCESS;
+
+  // Load measurement plan:
+  const char* filename = argc > 1 ? argv[1] : "OscilloscopeMeasurementPlan.txt";
+  MeasurementPlan_t* plan = loadMeasurementPlan(filename);
+  if(!plan)
+  {
+    return EXIT_FAILURE;
+  }
+
+  // Initialize library:
+  LibInit();
+
+  // Print library information:
+  printLibraryInfo();
+
+  // Update device list, search local devices first and network devices in the background:
+  startDiscovery(DISCOVERY_LOCAL_FIRST, printDiscoveredDevice, NULL);
+
+  // Try to open an oscilloscope and, if available, a generator in the same device:
+  LibTiePieHandle_t scp = LIBTIEPIE_HANDLE_INVALID;
+  LibTiePieHandle_t gen = LIBTIEPIE_HANDLE_INVALID;
+
+  do
+  {
+    for(uint32_t index = 0; index < LstGetCount(); index++)
+    {
+      // Open by serial number, indices change when network devices are added in the background:
+      const uint32_t serialNumber = LstDevGetSerialNumber(IDKIND_INDEX, index);
+
+      if(LstDevCanOpen(IDKIND_SERIALNUMBER, serialNumber, DEVICETYPE_OSCILLOSCOPE))
+      {
+        scp = LstOpenOscilloscope(IDKIND_SERIALNUMBER, serialNumber);
+        CHECK_LAST_STATUS();
+
+        if(scp != LIBTIEPIE_HANDLE_INVALID)
+        {
+          if(LstDevCanOpen(IDKIND_SERIALNUMBER, serialNumber, DEVICETYPE_GENERATOR))
+          {
+            gen = LstOpenGenerator(IDKIND_SERIALNUMBER, serialNumber);
+            CHECK_LAST_STATUS();
+          }
+          break;
+        }
+      }
+    }
+  }
+  while(scp == LIBTIEPIE_HANDLE_INVALID && waitForDiscovery()); // Not found, retry when network search completes.
+
+  if(scp != LIBTIEPIE_HANDLE_INVALID)
+  {
+    PlanExecutor_t executor;
+    planExecutorInit(&executor, scp, gen);
+
+    for(uint32_t i = 0; i < plan->stepCount && status == EXIT_SUCCESS; i++)
+    {
+      const PlanStep_t* step = &plan->steps[i];
+
+      printf("Step %" PRIu32 "/%" PRIu32 ": %s" NEWLINE, i + 1, plan->stepCount, step->name);
+
+      // Apply changed settings:
+      const uint64_t start = getTimeNanoSeconds();
+      const uint32_t callCount = applyPlanStep(&executor, step);
+      printf("  %" PRIu32 " setting(s) changed in %.3f ms" NEWLINE, callCount, (getTimeNanoSeconds() - start) / 1e6);
+
+      // Capture:
+      if(step->capture && !capture(scp, step->capture))
+      {
+        status = EXIT_FAILURE;
+      }
+    }
+
+    printf("Total: %" PRIu32 " setting(s) changed, %" PRIu32 " unchanged setting(s) skipped" NEWLINE, executor.callCount, executor.skipCount);
+    if(executor.uploadCount > 0 || executor.uploadSkipCount > 0)
+      printf("       %" PRIu32 " data upload(s), %" PRIu32 " unchanged upload(s) skipped" NEWLINE, executor.uploadCount, executor.uploadSkipCount);
+
+    // Close generator:
+    if(gen != LIBTIEPIE_HANDLE_INVALID)
+    {
+      GenSetOutputOn(gen, BOOL8_FALSE);
+      genInvalidateDataCache(gen);
+      ObjClose(gen);
+      CHECK_LAST_STATUS();
+    }
+
+    // Close oscilloscope:
+    ObjClose(scp);
+    CHECK_LAST_STATUS();
+  }
+  else
+  {
+    fprintf(stderr, "No oscilloscope available!" NEWLINE);
+    status = EXIT_FAILURE;
+  }
+
+  // Stop device discovery:
+  stopDiscovery();
+
+  // Exit library:
+  LibExit();
+
+  freeMeasurementPlan(plan);
+
+  return status;
+}
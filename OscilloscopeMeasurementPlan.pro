@@ -0,0 +1,48 @@
+TEMPLATE = app
+CONFIG += console
+CONFIG -= app_bundle
+CONFIG -= qt
+
+LIBS += -ltiepie -lpthread
+
+win32 {
+  msvc*:error("The Microsoft Visual C++ Compiler is not supported, please use MinGW.")
+
+  QMAKE_CFLAGS += -std=c99
+  LIBS += -L$$PWD
+  COPY_FILE_TO_BUILD_DIRECTORY += $$PWD\libtiepie.dll
+}
+
+COPY_FILE_TO_BUILD_DIRECTORY += $$PWD/OscilloscopeMeasurementPlan.txt
+
+unix {
+  QMAKE_CFLAGS += -std=gnu99 -pthread
+  LIBS += -lm
+}
+
+HEADERS += CheckStatus.h \
+           DeviceInfo.h \
+           Discovery.h \
+           MeasurementPlan.h \
+           Parallel.h \
+           PrintInfo.h \
+           UploadCache.h \
+           Utils.h \
+           WaveformFile.h
+
+
+SOURCES += OscilloscopeMeasurementPlan.c \
+           CheckStatus.c \
+           DeviceInfo.c \
+           Discovery.c \
+           MeasurementPlan.c \
+           Parallel.c \
+           PrintInfo.c \
+           UploadCache.c \
+           Utils.c \
+           WaveformFile.c
+
+# Copy files to build directory:
+for(FILE,COPY_FILE_TO_BUILD_DIRECTORY) {
+  QMAKE_POST_LINK += $$quote($(COPY_FILE) \"$${FILE}\" \"$$OUT_PWD/\"$(DESTDIR) $$escape_expand(\n\t))
+}
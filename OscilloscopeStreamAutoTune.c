@@ -0,0 +1,360 @@
+/**
+ * OscilloscopeStreamAutoTune.c
+ *
+ * This example finds the highest sustainable stream mode sample frequency, with the smallest safe chunk size, for this host, oscilloscope and data sink.
+ * Short probe streams are made for descending sample frequencies and ascending chunk durations, writing the data to OscilloscopeStreamAutoTune.bin.
+ * A setting is sustainable when no data overflow occurs and getting plus writing a chunk takes at most half of the chunk duration.
+ * The chosen setting is saved in OscilloscopeStream.profile, per oscilloscope and channel count.
+ * When a profile exists, it is used for a verification stream instead, unless tuning is requested.
+ * Usage: OscilloscopeStreamAutoTune [tune]
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <inttypes.h>
+#include <libtiepie.h>
+#include "CheckStatus.h"
+#include "Discovery.h"
+#include "Event.h"
+#include "PrintInfo.h"
+#include "SampleBuffer.h"
+#include "StreamProfile.h"
+#include "Utils.h"
+
+#define SAMPLE_FREQUENCY_MIN 1e3 // Lowest sample frequency to try.
+#define PROBE_TIME 1.0 // Seconds per probe stream.
+#define PROBE_CHUNK_COUNT_MIN 10 // Chunks per probe stream, at least.
+#define VERIFY_TIME 10.0 // Seconds for the verification stream.
+#define LOAD_MAX 0.5 // Part of the chunk duration that getting and writing a chunk may take.
+
+static const double chunkDurations[] = {1e-3, 2e-3, 5e-3, 10e-3, 20e-3, 50e-3, 100e-3, 200e-3}; // s
+#define CHUNK_DURATION_COUNT (sizeof(chunkDurations) / sizeof(chunkDurations[0]))
+
+typedef struct
+{
+  LibTiePieHandle_t scp;
+  uint16_t channelCount;
+  Event_t data; // Data ready or overflow.
+  FILE* sink;
+} Tuner_t;
+
+// Stream for duration seconds. Returns BOOL8_TRUE if sustainable, load is the highest part of a chunk duration used to get and write a chunk:
+static bool8_t probe(Tuner_t* tuner, double sampleFrequency, uint64_t recordLength, double duration, double* load)
+{
+  SampleBuffer_t buffer;
+  bool8_t sustainable = BOOL8_TRUE;
+
+  *load = 0;
+
+  // Set sample frequency and record length:
+  sampleFrequency = ScpSetSampleFrequency(tuner->scp, sampleFrequency);
+  CHECK_LAST_STATUS();
+
+  recordLength = ScpSetRecordLength(tuner->scp, recordLength);
+  CHECK_LAST_STATUS();
+
+  if(!sampleBufferAlloc(&buffer, tuner->channelCount, recordLength, BOOL8_FALSE))
+  {
+    fprintf(stderr, "Out of memory!" NEWLINE);
+    return BOOL8_FALSE;
+  }
+
+  const double chunkDuration = recordLength / sampleFrequency;
+  uint64_t chunkCount = (uint64_t)ceil(duration / chunkDuration);
+  if(chunkCount < PROBE_CHUNK_COUNT_MIN)
+    chunkCount = PROBE_CHUNK_COUNT_MIN;
+
+  // Overwrite the sink file each probe:
+  rewind(tuner->sink);
+  eventReset(&tuner->data);
+
+  // Start measurement:
+  ScpStart(tuner->scp);
+  CHECK_LAST_STATUS();
+
+  for(uint64_t chunk = 0; chunk < chunkCount; chunk++)
+  {
+    // Wait for data, woken up by the data ready and data overflow callbacks:
+    eventWaitForData(&tuner->data, tuner->scp);
+
+    if(ObjIsRemoved(tuner->scp) || ScpIsDataOverflow(tuner->scp))
+    {
+      sustainable = BOOL8_FALSE;
+      break;
+    }
+
+    // Get data and write it to the sink:
+    const uint64_t start = getTimeNanoSeconds();
+
+    const uint64_t samplesRead = ScpGetData(tuner->scp, buffer.channelData, tuner->channelCount, 0, recordLength);
+    CHECK_LAST_STATUS_FAST();
+
+    for(uint16_t ch = 0; ch < tuner->channelCount; ch++)
+      fwrite(buffer.channelData[ch], sizeof(float), samplesRead, tuner->sink);
+
+    const double chunkLoad = (getTimeNanoSeconds() - start) / 1e9 / chunkDuration;
+    if(chunkLoad > *load)
+      *load = chunkLoad;
+  }
+
+  // Stop measurement:
+  ScpStop(tuner->scp);
+  CHECK_LAST_STATUS();
+
+  sampleBufferFree(&buffer);
+
+  return sustainable && *load <= LOAD_MAX;
+}
+
+// Search the highest sustainable sample frequency with the smallest sustainable chunk. Returns BOOL8_FALSE if none is found:
+static bool8_t tune(Tuner_t* tuner, StreamProfile_t* profile)
+{
+  const double sampleFrequencyMax = ScpGetSampleFrequencyMax(tuner->scp);
+  CHECK_LAST_STATUS();
+
+  const uint64_t recordLengthMax = ScpGetRecordLengthMax(tuner->scp);
+  CHECK_LAST_STATUS();
+
+  // Sample frequencies: the maximum, followed by 5, 2, 1 steps per decade below it:
+  static const double steps[] = {5, 2, 1};
+  double decade = pow(10, floor(log10(sampleFrequencyMax)));
+  double sampleFrequency = sampleFrequencyMax;
+  unsigned int step = 0;
+
+  printf("%14s %14s %12s %8s" NEWLINE, "Frequency (Hz)", "Chunk (S)", "Chunk (ms)", "Load");
+
+  while(sampleFrequency >= SAMPLE_FREQUENCY_MIN)
+  {
+    uint64_t previousLength = 0;
+
+    // Chunk sizes, smallest first:
+    for(unsigned int i = 0; i < CHUNK_DURATION_COUNT; i++)
+    {
+      uint64_t recordLength = (uint64_t)llround(sampleFrequency * chunkDurations[i]);
+      if(recordLength < 1)
+        recordLength = 1;
+      else if(recordLength > recordLengthMax)
+        recordLength = recordLengthMax;
+
+      if(recordLength == previousLength)
+        continue;
+      previousLength = recordLength;
+
+      double load;
+      const bool8_t sustainable = probe(tuner, sampleFrequency, recordLength, PROBE_TIME, &load);
+
+      if(ObjIsRemoved(tuner->scp))
+      {
+        fprintf(stderr, "Device gone!" NEWLINE);
+        return BOOL8_FALSE;
+      }
+
+      const double actualSampleFrequency = ScpGetSampleFrequency(tuner->scp);
+      const uint64_t actualRecordLength = ScpGetRecordLength(tuner->scp);
+      printf("%14.0f %14" PRIu64 " %12.3f %7.0f%%%s" NEWLINE, actualSampleFrequency, actualRecordLength, actualRecordLength / actualSampleFrequency * 1e3, load * 100, sustainable ? "" : (load <= LOAD_MAX ? " overflow" : " too slow"));
+
+      if(sustainable)
+      {
+        profile->sampleFrequency = actualSampleFrequency;
+        profile->recordLength = actualRecordLength;
+        return BOOL8_TRUE;
+      }
+    }
+
+    // Next lower sample frequency:
+    do
+    {
+      sampleFrequency = steps[step] * decade;
+      if(++step == sizeof(steps) / sizeof(steps[0]))
+      {
+        step = 0;
+        decade /= 10;
+      }
+    }
+    while(sampleFrequency >= sampleFrequencyMax);
+  }
+
+  return BOOL8_FALSE;
+}
+
+int main(int argc, char* argv[])
+{
+  int status = EXIT_SUCCESS;
+
+  // Check arguments:
+  const bool8_t forceTune = argc > 1 && strcmp(argv[1], "tune") == 0 ? BOOL8_TRUE : BOOL8_FALSE;
+  if(argc > 2 || (argc > 1 && !forceTune))
+  {
+    fprintf(stderr, "Usage: %s [tune]" NEWLINE, argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  // Initialize library:
+  LibInit();
+
+  // Print library information:
+  printLibraryInfo();
+
+  // Update device list, search local devices first and network devices in the background:
+  startDiscovery(DISCOVERY_LOCAL_FIRST, printDiscoveredDevice, NULL);
+
+  // Try to open an oscilloscope with with stream measurement support:
+  LibTiePieHandle_t scp = LIBTIEPIE_HANDLE_INVALID;
+
+  do
+  {
+    for(uint32_t index = 0; index < LstGetCount(); index++)
+    {
+      // Open by serial number, indices change when network devices are added in the background:
+      const uint32_t serialNumber = LstDevGetSerialNumber(IDKIND_INDEX, index);
+
+      if(LstDevCanOpen(IDKIND_SERIALNUMBER, serialNumber, DEVICETYPE_OSCILLOSCOPE))
+      {
+        scp = LstOpenOscilloscope(IDKIND_SERIALNUMBER, serialNumber);
+        CHECK_LAST_STATUS();
+
+        // Check for valid handle and stream measurement support:
+        if(scp != LIBTIEPIE_HANDLE_INVALID && (ScpGetMeasureModes(scp) & MM_STREAM))
+        {
+          break;
+        }
+        else
+        {
+          scp = LIBTIEPIE_HANDLE_INVALID;
+        }
+      }
+    }
+  }
+  while(scp == LIBTIEPIE_HANDLE_INVALID && waitForDiscovery()); // Not found, retry when network search completes.
+
+  if(scp != LIBTIEPIE_HANDLE_INVALID)
+  {
+    Tuner_t tuner;
+    tuner.scp = scp;
+
+    // Get the number of channels:
+    tuner.channelCount = ScpGetChannelCount(scp);
+    CHECK_LAST_STATUS();
+
+    // Set measure mode:
+    ScpSetMeasureMode(scp, MM_STREAM);
+    CHECK_LAST_STATUS();
+
+    // For all channels:
+    for(uint16_t ch = 0; ch < tuner.channelCount; ch++)
+    {
+      // Enable channel to measure it:
+      ScpChSetEnabled(scp, ch, BOOL8_TRUE);
+      CHECK_LAST_STATUS();
+
+      // Set range:
+      ScpChSetRange(scp, ch, 8); // 8 V
+      CHECK_LAST_STATUS();
+
+      // Set coupling:
+      ScpChSetCoupling(scp, ch, CK_DCV); // DC Volt
+      CHECK_LAST_STATUS();
+    }
+
+    // Print oscilloscope info:
+    printDeviceInfo(scp);
+
+    // Signal data ready and data overflow:
+    eventInit(&tuner.data);
+
+    ScpSetCallbackDataReady(scp, eventCallback, &tuner.data);
+    CHECK_LAST_STATUS();
+
+    ScpSetCallbackDataOverflow(scp, eventCallback, &tuner.data);
+    CHECK_LAST_STATUS();
+
+    const char* sinkFilename = "OscilloscopeStreamAutoTune.bin";
+    const char* profileFilename = "OscilloscopeStream.profile";
+    tuner.sink = fopen(sinkFilename, "wb");
+    if(tuner.sink)
+    {
+      StreamProfile_t profile;
+      profile.serialNumber = DevGetSerialNumber(scp);
+      CHECK_LAST_STATUS();
+      profile.channelCount = tuner.channelCount;
+
+      if(!forceTune && loadStreamProfile(&profile, profileFilename, profile.serialNumber, profile.channelCount))
+      {
+        // Verify the saved profile:
+        printf("Using profile from %s: %.0f Hz, chunks of %" PRIu64 " samples" NEWLINE, profileFilename, profile.sampleFrequency, profile.recordLength);
+
+        double load;
+        if(probe(&tuner, profile.sampleFrequency, profile.recordLength, VERIFY_TIME, &load))
+        {
+          printf("Sustained for %.0f s, load %.0f%%" NEWLINE, VERIFY_TIME, load * 100);
+        }
+        else if(ObjIsRemoved(scp))
+        {
+          fprintf(stderr, "Device gone!" NEWLINE);
+          status = EXIT_FAILURE;
+        }
+        else
+        {
+          fprintf(stderr, "Profile not sustainable (load %.0f%%), run: %s tune" NEWLINE, load * 100, argv[0]);
+          status = EXIT_FAILURE;
+        }
+      }
+      else
+      {
+        printf("Tuning, %.0f s per probe..." NEWLINE, PROBE_TIME);
+
+        if(tune(&tuner, &profile))
+        {
+          printf("Highest sustainable: %.0f Hz, chunks of %" PRIu64 " samples (%.3f ms)" NEWLINE, profile.sampleFrequency, profile.recordLength, profile.recordLength / profile.sampleFrequency * 1e3);
+
+          if(saveStreamProfile(&profile, profileFilename))
+            printf("Profile written to: %s" NEWLINE, profileFilename);
+          else
+            status = EXIT_FAILURE;
+        }
+        else
+        {
+          fprintf(stderr, "No sustainable setting found!" NEWLINE);
+          status = EXIT_FAILURE;
+        }
+      }
+
+      // Close file:
+      fclose(tuner.sink);
+    }
+    else
+    {
+      fprintf(stderr, "Couldn't open file: %s" NEWLINE, sinkFilename);
+      status = EXIT_FAILURE;
+    }
+
+    ScpSetCallbackDataReady(scp, NULL, NULL);
+    CHECK_LAST_STATUS();
+
+    ScpSetCallbackDataOverflow(scp, NULL, NULL);
+    CHECK_LAST_STATUS();
+
+    eventFree(&tuner.data);
+
+    // Close oscilloscope:
+    ObjClose(scp);
+    CHECK_LAST_STATUS();
+  }
+  else
+  {
+    fprintf(stderr, "No oscilloscope available with stream measurement support!" NEWLINE);
+    status = EXIT_FAILURE;
+  }
+
+  // Stop device discovery:
+  stopDiscovery();
+
+  // Exit library:
+  LibExit();
+
+  return status;
+}
@@ -0,0 +1,417 @@
+/**
+ * OscilloscopeStreamRealTime.c
+ *
+ * This example performs a stream mode measurement twice, without and with a real-time profile, and reports the data overflows of both.
+ * The real-time profile runs the thread reading the data with SCHED_FIFO priority pinned to one processor,
+ * locks and pre-faults the sample buffers and runs the thread writing the data on the other processors.
+ * The data is written to OscilloscopeStreamRealTime.bin as raw float32, per chunk all channels after each other.
+ * Usage: OscilloscopeStreamRealTime [sample frequency Hz] [priority] [cpu], default 1 MHz, 50 and the last processor.
+ * SCHED_FIFO needs root or CAP_SYS_NICE and locking memory may need a higher RLIMIT_MEMLOCK on Linux.
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include <libtiepie.h>
+#include "CheckStatus.h"
+#include "Discovery.h"
+#include "Event.h"
+#include "PrintInfo.h"
+#include "Queue.h"
+#include "RealTime.h"
+#include "Utils.h"
+
+#define RECORD_LENGTH 10000 // Samples per chunk.
+#define CHUNK_COUNT 1000 // Chunks per run.
+#define BUFFER_COUNT 8 // Chunks in flight between reading and writing.
+
+typedef struct
+{
+  float** channelData;
+  uint64_t length;
+} Chunk_t;
+
+typedef struct
+{
+  LibTiePieHandle_t scp;
+  uint16_t channelCount;
+  uint64_t recordLength;
+  const RealTimeProfile_t* profile;
+  Event_t data; // Data ready or overflow.
+  Queue_t filled;
+  Queue_t free; // Buffer pool.
+  FILE* file;
+  uint32_t chunkCount; // Read.
+  uint32_t overflowCount;
+  bool8_t removed;
+  bool8_t prioritySet;
+  bool8_t cpuSet;
+  bool8_t writeFailed;
+} Stream_t;
+
+static void* readChunks(void* arg)
+{
+  Stream_t* stream = arg;
+
+  if(stream->profile->enabled)
+  {
+    stream->prioritySet = realTimeSetPriority(stream->profile->priority);
+    stream->cpuSet = realTimeSetCpu(stream->profile->cpu);
+  }
+
+  // Start measurement:
+  ScpStart(stream->scp);
+  CHECK_LAST_STATUS_FAST();
+
+  while(stream->chunkCount < CHUNK_COUNT)
+  {
+    // Wait for data, woken up by the data ready and data overflow callbacks:
+    eventWaitForData(&stream->data, stream->scp);
+
+    if(ObjIsRemoved(stream->scp))
+    {
+      stream->removed = BOOL8_TRUE;
+      break;
+    }
+
+    // Count data overflow and restart measurement:
+    if(ScpIsDataOverflow(stream->scp))
+    {
+      stream->overflowCount++;
+
+      ScpStop(stream->scp);
+      CHECK_LAST_STATUS_FAST();
+
+      ScpStart(stream->scp);
+      CHECK_LAST_STATUS_FAST();
+      continue;
+    }
+
+    // Get data:
+    Chunk_t* chunk = queuePop(&stream->free);
+    chunk->length = ScpGetData(stream->scp, chunk->channelData, stream->channelCount, 0, stream->recordLength);
+    CHECK_LAST_STATUS_FAST();
+
+    queuePush(&stream->filled, chunk);
+    stream->chunkCount++;
+  }
+
+  // Stop measurement:
+  ScpStop(stream->scp);
+  CHECK_LAST_STATUS_FAST();
+
+  queueClose(&stream->filled);
+
+  return NULL;
+}
+
+static void* writeChunks(void* arg)
+{
+  Stream_t* stream = arg;
+  Chunk_t* chunk;
+
+  // Keep the processor of the reading thread free:
+  if(stream->profile->enabled)
+    realTimeAvoidCpu(stream->profile->cpu);
+
+  while((chunk = queuePop(&stream->filled)))
+  {
+    for(uint16_t ch = 0; ch < stream->channelCount; ch++)
+    {
+      if(fwrite(chunk->channelData[ch], sizeof(float), chunk->length, stream->file) != chunk->length)
+        stream->writeFailed = BOOL8_TRUE;
+    }
+
+    // Return buffer to the pool:
+    queuePush(&stream->free, chunk);
+  }
+
+  return NULL;
+}
+
+// Measure CHUNK_COUNT chunks with or without real-time profile, returns BOOL8_FALSE on error:
+static bool8_t run(Stream_t* stream, const char* filename, double* seconds, bool8_t* locked)
+{
+  const size_t chunkSize = sizeof(float) * stream->channelCount * stream->recordLength;
+  bool8_t result = BOOL8_TRUE;
+
+  stream->chunkCount = 0;
+  stream->overflowCount = 0;
+  stream->removed = BOOL8_FALSE;
+  stream->prioritySet = BOOL8_FALSE;
+  stream->cpuSet = BOOL8_FALSE;
+  stream->writeFailed = BOOL8_FALSE;
+  *locked = BOOL8_FALSE;
+
+  // Create data buffers, in one block to lock them at once:
+  float* memory = malloc(chunkSize * BUFFER_COUNT);
+  Chunk_t* chunks = malloc(sizeof(Chunk_t) * BUFFER_COUNT);
+  float** pointers = malloc(sizeof(float*) * stream->channelCount * BUFFER_COUNT);
+
+  if(!memory || !chunks || !pointers || !queueInit(&stream->free, BUFFER_COUNT))
+  {
+    fprintf(stderr, "Out of memory!" NEWLINE);
+    free(pointers);
+    free(chunks);
+    free(memory);
+    return BOOL8_FALSE;
+  }
+
+  if(!queueInit(&stream->filled, BUFFER_COUNT))
+  {
+    fprintf(stderr, "Out of memory!" NEWLINE);
+    queueFree(&stream->free);
+    free(pointers);
+    free(chunks);
+    free(memory);
+    return BOOL8_FALSE;
+  }
+
+  // Locked and mapped before measuring, no page faults while measuring:
+  if(stream->profile->enabled)
+    *locked = realTimeLockMemory(memory, chunkSize * BUFFER_COUNT);
+
+  for(unsigned int i = 0; i < BUFFER_COUNT; i++)
+  {
+    chunks[i].channelData = &pointers[i * stream->channelCount];
+    for(uint16_t ch = 0; ch < stream->channelCount; ch++)
+      chunks[i].channelData[ch] = memory + (i * stream->channelCount + ch) * stream->recordLength;
+    queuePush(&stream->free, &chunks[i]);
+  }
+
+  // Open file with write permissions:
+  stream->file = fopen(filename, "wb");
+  if(stream->file)
+  {
+    eventReset(&stream->data);
+
+    const uint64_t start = getTimeNanoSeconds();
+
+    pthread_t reader;
+    pthread_t writer;
+    if(pthread_create(&writer, NULL, writeChunks, stream) == 0)
+    {
+      if(pthread_create(&reader, NULL, readChunks, stream) == 0)
+      {
+        pthread_join(reader, NULL);
+      }
+      else
+      {
+        fprintf(stderr, "Couldn't create thread!" NEWLINE);
+        queueClose(&stream->filled);
+        result = BOOL8_FALSE;
+      }
+
+      pthread_join(writer, NULL);
+    }
+    else
+    {
+      fprintf(stderr, "Couldn't create thread!" NEWLINE);
+      result = BOOL8_FALSE;
+    }
+
+    *seconds = (getTimeNanoSeconds() - start) / 1e9;
+
+    // Close file:
+    fclose(stream->file);
+
+    if(stream->writeFailed)
+    {
+      fprintf(stderr, "Couldn't write file: %s" NEWLINE, filename);
+      result = BOOL8_FALSE;
+    }
+  }
+  else
+  {
+    fprintf(stderr, "Couldn't open file: %s" NEWLINE, filename);
+    result = BOOL8_FALSE;
+  }
+
+  if(*locked)
+    realTimeUnlockMemory(memory, chunkSize * BUFFER_COUNT);
+
+  // Delete data buffers:
+  queueFree(&stream->filled);
+  queueFree(&stream->free);
+  free(pointers);
+  free(chunks);
+  free(memory);
+
+  return result && !stream->removed;
+}
+
+int main(int argc, char* argv[])
+{
+  int status = EXIT_SUCCESS;
+
+  // Check arguments:
+  const double sampleFrequency = argc > 1 ? atof(argv[1]) : 1e6;
+  RealTimeProfile_t profile;
+  profile.priority = argc > 2 ? atoi(argv[2]) : 50;
+  profile.cpu = argc > 3 ? (unsigned int)strtoul(argv[3], NULL, 10) : getProcessorCount() - 1;
+  if(sampleFrequency <= 0 || profile.priority < 1 || profile.priority > 99 || profile.cpu >= getProcessorCount())
+  {
+    fprintf(stderr, "Usage: %s [sample frequency Hz] [priority 1..99] [cpu 0..%u]" NEWLINE, argv[0], getProcessorCount() - 1);
+    return EXIT_FAILURE;
+  }
+
+  // Initialize library:
+  LibInit();
+
+  // Print library information:
+  printLibraryInfo();
+
+  // Update device list, search local devices first and network devices in the background:
+  startDiscovery(DISCOVERY_LOCAL_FIRST, printDiscoveredDevice, NULL);
+
+  // Try to open an oscilloscope with with stream measurement support:
+  LibTiePieHandle_t scp = LIBTIEPIE_HANDLE_INVALID;
+
+  do
+  {
+    for(uint32_t index = 0; index < LstGetCount(); index++)
+    {
+      // Open by serial number, indices change when network devices are added in the background:
+      const uint32_t serialNumber = LstDevGetSerialNumber(IDKIND_INDEX, index);
+
+      if(LstDevCanOpen(IDKIND_SERIALNUMBER, serialNumber, DEVICETYPE_OSCILLOSCOPE))
+      {
+        scp = LstOpenOscilloscope(IDKIND_SERIALNUMBER, serialNumber);
+        CHECK_LAST_STATUS();
+
+        // Check for valid handle and stream measurement support:
+        if(scp != LIBTIEPIE_HANDLE_INVALID && (ScpGetMeasureModes(scp) & MM_STREAM))
+        {
+          break;
+        }
+        else
+        {
+          scp = LIBTIEPIE_HANDLE_INVALID;
+        }
+      }
+    }
+  }
+  while(scp == LIBTIEPIE_HANDLE_INVALID && waitForDiscovery()); // Not found, retry when network search completes.
+
+  if(scp != LIBTIEPIE_HANDLE_INVALID)
+  {
+    Stream_t stream;
+    stream.scp = scp;
+    stream.profile = &profile;
+
+    // Get the number of channels:
+    stream.channelCount = ScpGetChannelCount(scp);
+    CHECK_LAST_STATUS();
+
+    // Set measure mode:
+    ScpSetMeasureMode(scp, MM_STREAM);
+    CHECK_LAST_STATUS();
+
+    // Set sample frequency:
+    const double actualSampleFrequency = ScpSetSampleFrequency(scp, sampleFrequency);
+    CHECK_LAST_STATUS();
+
+    // Set record length:
+    stream.recordLength = ScpSetRecordLength(scp, RECORD_LENGTH);
+    CHECK_LAST_STATUS();
+
+    // For all channels:
+    for(uint16_t ch = 0; ch < stream.channelCount; ch++)
+    {
+      // Enable channel to measure it:
+      ScpChSetEnabled(scp, ch, BOOL8_TRUE);
+      CHECK_LAST_STATUS();
+
+      // Set range:
+      ScpChSetRange(scp, ch, 8); // 8 V
+      CHECK_LAST_STATUS();
+
+      // Set coupling:
+      ScpChSetCoupling(scp, ch, CK_DCV); // DC Volt
+      CHECK_LAST_STATUS();
+    }
+
+    // Print oscilloscope info:
+    printDeviceInfo(scp);
+
+    // Signal data ready and data overflow:
+    eventInit(&stream.data);
+
+    ScpSetCallbackDataReady(scp, eventCallback, &stream.data);
+    CHECK_LAST_STATUS();
+
+    ScpSetCallbackDataOverflow(scp, eventCallback, &stream.data);
+    CHECK_LAST_STATUS();
+
+    const char* filename = "OscilloscopeStreamRealTime.bin";
+    uint32_t overflowCounts[2] = {0, 0};
+    double seconds[2] = {0, 0};
+
+    // Without and with real-time profile:
+    for(int i = 0; i < 2 && status == EXIT_SUCCESS; i++)
+    {
+      bool8_t locked;
+
+      profile.enabled = i == 1 ? BOOL8_TRUE : BOOL8_FALSE;
+
+      printf("Measuring %u chunks of %" PRIu64 " samples at %.0f Hz, real-time profile %s..." NEWLINE, CHUNK_COUNT, stream.recordLength, actualSampleFrequency, profile.enabled ? "on" : "off");
+
+      if(!run(&stream, filename, &seconds[i], &locked))
+      {
+        if(stream.removed)
+          fprintf(stderr, "Device gone!" NEWLINE);
+        status = EXIT_FAILURE;
+      }
+
+      overflowCounts[i] = stream.overflowCount;
+
+      if(profile.enabled)
+      {
+        if(!stream.prioritySet)
+          fprintf(stderr, "Couldn't set real-time priority %d, not permitted?" NEWLINE, profile.priority);
+        if(!stream.cpuSet)
+          fprintf(stderr, "Couldn't pin reading thread to processor %u" NEWLINE, profile.cpu);
+        if(!locked)
+          fprintf(stderr, "Couldn't lock sample buffers, pre-faulted only" NEWLINE);
+      }
+    }
+
+    ScpSetCallbackDataReady(scp, NULL, NULL);
+    CHECK_LAST_STATUS();
+
+    ScpSetCallbackDataOverflow(scp, NULL, NULL);
+    CHECK_LAST_STATUS();
+
+    eventFree(&stream.data);
+
+    // Print results:
+    printf("%10s %12s %12s" NEWLINE, "Profile", "Overflows", "Time (s)");
+    for(int i = 0; i < 2; i++)
+    {
+      printf("%10s %12" PRIu32 " %12.3f" NEWLINE, i == 1 ? "real-time" : "normal", overflowCounts[i], seconds[i]);
+    }
+
+    if(status == EXIT_SUCCESS)
+      printf("Data written to: %s" NEWLINE, filename);
+
+    // Close oscilloscope:
+    ObjClose(scp);
+    CHECK_LAST_STATUS();
+  }
+  else
+  {
+    fprintf(stderr, "No oscilloscope available with stream measurement support!" NEWLINE);
+    status = EXIT_FAILURE;
+  }
+
+  // Stop device discovery:
+  stopDiscovery();
+
+  // Exit library:
+  LibExit();
+
+  return status;
+}
@@ -0,0 +1,286 @@
+/**
+ * OscilloscopeStreamRecovery.c
+ *
+ * This example performs a long stream mode measurement that survives data overflows, and writes the data to OscilloscopeStreamRecovery.csv.
+ * On a data overflow the measurement is restarted immediately and a gap record with the lost interval is written to the csv file:
+ *   # Gap after sample <n>: <seconds> s, about <samples> samples lost
+ * The Time column includes the gaps. Overflows, gap durations and restart latencies are reported at the end.
+ * Usage: OscilloscopeStreamRecovery [duration s] [sample frequency Hz], default 60 s at 100 kHz.
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include <inttypes.h>
+#include <libtiepie.h>
+#include "CheckStatus.h"
+#include "Discovery.h"
+#include "Event.h"
+#include "Latency.h"
+#include "PrintInfo.h"
+#include "Utils.h"
+
+#define RECORD_DURATION 0.1 // Seconds per chunk.
+
+int main(int argc, char* argv[])
+{
+  int status = EXIT_SUCCESS;
+
+  // Check arguments:
+  const double duration = argc > 1 ? atof(argv[1]) : 60;
+  const double sampleFrequency = argc > 2 ? atof(argv[2]) : 100e3;
+  if(duration <= 0 || sampleFrequency <= 0)
+  {
+    fprintf(stderr, "Usage: %s [duration s] [sample frequency Hz]" NEWLINE, argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  // Initialize library:
+  LibInit();
+
+  // Print library information:
+  printLibraryInfo();
+
+  // Update device list, search local devices first and network devices in the background:
+  startDiscovery(DISCOVERY_LOCAL_FIRST, printDiscoveredDevice, NULL);
+
+  // Try to open an oscilloscope with with stream measurement support:
+  LibTiePieHandle_t scp = LIBTIEPIE_HANDLE_INVALID;
+
+  do
+  {
+    for(uint32_t index = 0; index < LstGetCount(); index++)
+    {
+      // Open by serial number, indices change when network devices are added in the background:
+      const uint32_t serialNumber = LstDevGetSerialNumber(IDKIND_INDEX, index);
+
+      if(LstDevCanOpen(IDKIND_SERIALNUMBER, serialNumber, DEVICETYPE_OSCILLOSCOPE))
+      {
+        scp = LstOpenOscilloscope(IDKIND_SERIALNUMBER, serialNumber);
+        CHECK_LAST_STATUS();
+
+        // Check for valid handle and stream measurement support:
+        if(scp != LIBTIEPIE_HANDLE_INVALID && (ScpGetMeasureModes(scp) & MM_STREAM))
+        {
+          break;
+        }
+        else
+        {
+          scp = LIBTIEPIE_HANDLE_INVALID;
+        }
+      }
+    }
+  }
+  while(scp == LIBTIEPIE_HANDLE_INVALID && waitForDiscovery()); // Not found, retry when network search completes.
+
+  if(scp != LIBTIEPIE_HANDLE_INVALID)
+  {
+    // Get the number of channels:
+    const uint16_t channelCount = ScpGetChannelCount(scp);
+    CHECK_LAST_STATUS();
+
+    // Set measure mode:
+    ScpSetMeasureMode(scp, MM_STREAM);
+    CHECK_LAST_STATUS();
+
+    // Set sample frequency:
+    const double actualSampleFrequency = ScpSetSampleFrequency(scp, sampleFrequency);
+    CHECK_LAST_STATUS();
+
+    // Set record length:
+    const uint64_t recordLength = ScpSetRecordLength(scp, (uint64_t)ceil(actualSampleFrequency * RECORD_DURATION));
+    CHECK_LAST_STATUS();
+
+    // For all channels:
+    for(uint16_t ch = 0; ch < channelCount; ch++)
+    {
+      // Enable channel to measure it:
+      ScpChSetEnabled(scp, ch, BOOL8_TRUE);
+      CHECK_LAST_STATUS_FAST();
+
+      // Set range:
+      ScpChSetRange(scp, ch, 8); // 8 V
+      CHECK_LAST_STATUS_FAST();
+
+      // Set coupling:
+      ScpChSetCoupling(scp, ch, CK_DCV); // DC Volt
+      CHECK_LAST_STATUS_FAST();
+    }
+
+    // Print oscilloscope info:
+    printDeviceInfo(scp);
+
+    // Create data buffers:
+    float** channelData = malloc(sizeof(float*) * channelCount);
+    for(uint16_t ch = 0; ch < channelCount; ch++)
+    {
+      channelData[ch] = malloc(sizeof(float) * recordLength);
+    }
+
+    // Signal data ready and data overflow:
+    Event_t data;
+    eventInit(&data);
+
+    ScpSetCallbackDataReady(scp, eventCallback, &data);
+    CHECK_LAST_STATUS();
+
+    ScpSetCallbackDataOverflow(scp, eventCallback, &data);
+    CHECK_LAST_STATUS();
+
+    // Open file with write/update permissions:
+    const char* filename = "OscilloscopeStreamRecovery.csv";
+    FILE* csv = fopen(filename, "w");
+    if(csv)
+    {
+      Latency_t gaps; // Lost intervals.
+      Latency_t restarts; // From overflow detection to running again.
+      uint64_t currentSample = 0;
+      uint64_t lostSampleCount = 0;
+      double gapTime = 0; // s
+
+      latencyInit(&gaps);
+      latencyInit(&restarts);
+
+      // Write csv header:
+      fprintf(csv, "Sample;Time");
+      for(uint16_t ch = 0; ch < channelCount; ch++)
+      {
+        fprintf(csv, ";Ch%" PRIu16, (ch + 1));
+      }
+      fprintf(csv, NEWLINE);
+
+      printf("Measuring %.0f s at %.0f Hz..." NEWLINE, duration, actualSampleFrequency);
+
+      // Start measurement:
+      ScpStart(scp);
+      CHECK_LAST_STATUS();
+
+      const uint64_t start = getTimeNanoSeconds();
+      const uint64_t end = start + (uint64_t)(duration * 1e9);
+      uint64_t lastData = start; // End of the data received so far.
+
+      while(getTimeNanoSeconds() < end)
+      {
+        // Wait for data, woken up by the data ready and data overflow callbacks:
+        eventWaitForData(&data, scp);
+
+        // Print error on device remove:
+        if(ObjIsRemoved(scp))
+        {
+          fprintf(stderr, "Device gone!" NEWLINE);
+          status = EXIT_FAILURE;
+          break;
+        }
+
+        // Restart on data overflow:
+        if(ScpIsDataOverflow(scp))
+        {
+          const uint64_t detected = getTimeNanoSeconds();
+
+          ScpStop(scp);
+          CHECK_LAST_STATUS_FAST();
+
+          ScpStart(scp);
+          CHECK_LAST_STATUS_FAST();
+
+          const uint64_t restarted = getTimeNanoSeconds();
+
+          // Everything after the last received data is lost, up to the restart:
+          const double gap = (restarted - lastData) / 1e9;
+          const uint64_t lost = (uint64_t)llround(gap * actualSampleFrequency);
+
+          latencyAdd(&restarts, restarted - detected);
+          latencyAdd(&gaps, restarted - lastData);
+          lostSampleCount += lost;
+          gapTime += gap;
+          lastData = restarted;
+
+          // Write gap record:
+          fprintf(csv, "# Gap after sample %" PRIu64 ": %.6f s, about %" PRIu64 " samples lost" NEWLINE, currentSample, gap, lost);
+          fprintf(stderr, "Data overflow, restarted in %.3f ms, %.3f ms lost" NEWLINE, (restarted - detected) / 1e6, gap * 1e3);
+          continue;
+        }
+
+        // Get data:
+        const uint64_t samplesRead = ScpGetData(scp, channelData, channelCount, 0, recordLength);
+        CHECK_LAST_STATUS_FAST();
+
+        lastData = getTimeNanoSeconds();
+
+        // Write the data to csv:
+        for(uint64_t i = 0; i < samplesRead; i++)
+        {
+          fprintf(csv, "%" PRIu64 ";%f", currentSample + i, (currentSample + i) / actualSampleFrequency + gapTime);
+          for(uint16_t ch = 0; ch < channelCount; ch++)
+          {
+            fprintf(csv, ";%f", channelData[ch][i]);
+          }
+          fprintf(csv, NEWLINE);
+        }
+
+        currentSample += samplesRead;
+      }
+
+      const double seconds = (getTimeNanoSeconds() - start) / 1e9;
+
+      // Stop measurement:
+      ScpStop(scp);
+      CHECK_LAST_STATUS();
+
+      // Print results:
+      printf("%" PRIu64 " samples received in %.3f s" NEWLINE, currentSample, seconds);
+      printf("Data overflows: %" PRIu64 ", lost: %.6f s (%.4f %%), about %" PRIu64 " samples" NEWLINE, gaps.count, gapTime, seconds > 0 ? gapTime / seconds * 100 : 0, lostSampleCount);
+      if(gaps.count > 0)
+      {
+        printLatencyHeader();
+        printLatency("Gap", &gaps);
+        printLatency("Restart", &restarts);
+      }
+
+      latencyFree(&restarts);
+      latencyFree(&gaps);
+
+      printf("Data written to: %s" NEWLINE, filename);
+
+      // Close file:
+      fclose(csv);
+    }
+    else
+    {
+      fprintf(stderr, "Couldn't open file: %s" NEWLINE, filename);
+      status = EXIT_FAILURE;
+    }
+
+    ScpSetCallbackDataReady(scp, NULL, NULL);
+    CHECK_LAST_STATUS();
+
+    ScpSetCallbackDataOverflow(scp, NULL, NULL);
+    CHECK_LAST_STATUS();
+
+    eventFree(&data);
+
+    // Delete data buffers:
+    for(uint16_t ch = 0; ch < channelCount; ch++)
+      free(channelData[ch]);
+    free(channelData);
+
+    // Close oscilloscope:
+    ObjClose(scp);
+    CHECK_LAST_STATUS();
+  }
+  else
+  {
+    fprintf(stderr, "No oscilloscope available with stream measurement support!" NEWLINE);
+    status = EXIT_FAILURE;
+  }
+
+  // Stop device discovery:
+  stopDiscovery();
+
+  // Exit library:
+  LibExit();
+
+  return status;
+}
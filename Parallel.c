@@ -0,0 +1,77 @@
+/**
+ * Parallel.c
+ *
+ * This file is part of the LibTiePie programming examples.
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#include "Parallel.h"
+#include <pthread.h>
+#include "Utils.h"
+
+#define PARALLEL_THREAD_MAX 64
+
+typedef struct
+{
+  ParallelFunction_t function;
+  uint64_t start;
+  uint64_t end;
+  void* arg;
+  uint8_t started;
+} ParallelJob_t;
+
+static void* runJob(void* arg)
+{
+  const ParallelJob_t* job = arg;
+  job->function(job->start, job->end, job->arg);
+  return NULL;
+}
+
+void parallelFor(uint64_t count, uint64_t granularity, uint64_t minCount, ParallelFunction_t function, void* arg)
+{
+  ParallelJob_t jobs[PARALLEL_THREAD_MAX];
+  pthread_t threads[PARALLEL_THREAD_MAX];
+  unsigned int threadCount = count < minCount ? 1 : getProcessorCount();
+
+  if(threadCount > PARALLEL_THREAD_MAX)
+    threadCount = PARALLEL_THREAD_MAX;
+  if(granularity == 0)
+    granularity = 1;
+
+  // Round the share up, so threadCount parts cover all of count:
+  const uint64_t share = (count + threadCount - 1) / threadCount;
+  const uint64_t part = ((share + granularity - 1) / granularity) * granularity;
+
+  for(unsigned int i = 0; i < threadCount; i++)
+  {
+    jobs[i].function = function;
+    jobs[i].start = i * part < count ? i * part : count;
+    jobs[i].end = (i + 1) * part < count ? (i + 1) * part : count;
+    jobs[i].arg = arg;
+    jobs[i].started = 0;
+  }
+
+  // The last part always ends at count, no index is left out:
+  jobs[threadCount - 1].end = count;
+
+  // Run the first part on this thread, and parts of threads that can't be created:
+  for(unsigned int i = 1; i < threadCount; i++)
+  {
+    if(jobs[i].start < jobs[i].end)
+    {
+      if(pthread_create(&threads[i], NULL, runJob, &jobs[i]) == 0)
+        jobs[i].started = 1;
+      else
+        runJob(&jobs[i]);
+    }
+  }
+
+  runJob(&jobs[0]);
+
+  for(unsigned int i = 1; i < threadCount; i++)
+  {
+    if(jobs[i].started)
+      pthread_join(threads[i], NULL);
+  }
+}
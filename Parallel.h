@@ -0,0 +1,20 @@
+/**
+ * Parallel.h
+ *
+ * This file is part of the LibTiePie programming examples.
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#ifndef _PARALLEL_H_
+#define _PARALLEL_H_
+
+#include <stdint.h>
+
+typedef void (*ParallelFunction_t)(uint64_t start, uint64_t end, void* arg);
+
+// Split 0..count in one part per processor and call function for each part on its own thread, returns when all are done.
+// Part boundaries are multiples of granularity, counts below minCount are done on the calling thread only.
+void parallelFor(uint64_t count, uint64_t granularity, uint64_t minCount, ParallelFunction_t function, void* arg);
+
+#endif
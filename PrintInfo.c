@@ -31,687 +31,622 @@ const char* ServerStatuses[] = {"Disconnected", "Connecting", "Connected", "Disc
 
 void printLibraryInfo()
 {
-  printf("Library:" NEWLINE);
+  LibraryInfo_t* info = getLibraryInfo();
+  printLibraryInfoSnapshot(info);
+  freeLibraryInfo(info);
+}
 
-  // Print library version:
-  printf("  Version: ");
-  printVersion(LibGetVersion());
-  printf("%s" NEWLINE, LibGetVersionExtra());
+void printDeviceInfo(LibTiePieHandle_t dev)
+{
+  if(dev == LIBTIEPIE_HANDLE_INVALID)
+  {
+    fprintf(stderr, "Invalid device handle in printDeviceInfo()" NEWLINE);
+    return;
+  }
 
-  // Print library configuration:
-  uint32_t length = LibGetConfig(NULL, 0);
-  uint8_t configuration[sizeof(uint8_t) * length];
-  length = LibGetConfig(configuration, length);
+  DeviceInfo_t* info = getDeviceInfo(dev);
+  printDeviceInfoSnapshot(info);
+  freeDeviceInfo(info);
+}
 
-  printf("  Configuration: 0x");
-  for(uint32_t i = 0; i < length; i++)
-    printf("%02" PRIx8, configuration[i]);
-  printf(NEWLINE);
+void printOscilloscopeInfo(LibTiePieHandle_t scp)
+{
+  if(scp == LIBTIEPIE_HANDLE_INVALID)
+  {
+    fprintf(stderr, "Invalid device handle in printOscilloscopeInfo()" NEWLINE);
+    return;
+  }
+
+  DeviceInfo_t* info = getDeviceTypeInfo(scp, DEVICETYPE_OSCILLOSCOPE);
+  printOscilloscopeInfoSnapshot(info);
+  freeDeviceInfo(info);
 }
 
-void printDeviceInfo(LibTiePieHandle_t dev)
+void printGeneratorInfo(LibTiePieHandle_t gen)
+{
+  if(gen == LIBTIEPIE_HANDLE_INVALID)
+  {
+    fprintf(stderr, "Invalid device handle in printGeneratorInfo()" NEWLINE);
+    return;
+  }
+
+  DeviceInfo_t* info = getDeviceTypeInfo(gen, DEVICETYPE_GENERATOR);
+  printGeneratorInfoSnapshot(info);
+  freeDeviceInfo(info);
+}
+
+void printI2CInfo(LibTiePieHandle_t i2c)
+{
+  if(i2c == LIBTIEPIE_HANDLE_INVALID)
+  {
+    fprintf(stderr, "Invalid device handle in printI2CInfo()" NEWLINE);
+    return;
+  }
+
+  DeviceInfo_t* info = getDeviceTypeInfo(i2c, DEVICETYPE_I2CHOST);
+  printI2CInfoSnapshot(info);
+  freeDeviceInfo(info);
+}
+
+void printServerInfo(LibTiePieHandle_t srv)
+{
+  if(srv == LIBTIEPIE_HANDLE_INVALID)
+  {
+    fprintf(stderr, "Invalid server handle in printServerInfo()" NEWLINE);
+    return;
+  }
+
+  ServerInfo_t* info = getServerInfo(srv);
+  printServerInfoSnapshot(info);
+  freeServerInfo(info);
+}
+
+void printTriggerInputsInfo(LibTiePieHandle_t dev)
 {
   if(dev == LIBTIEPIE_HANDLE_INVALID)
   {
-    fprintf(stderr, "Invalid device handle in printDeviceInfo()" NEWLINE);
+    fprintf(stderr, "Invalid device handle in printTriggerInputsInfo()" NEWLINE);
     return;
   }
 
-  printf("Device:" NEWLINE);
+  DeviceInfo_t* info = getDeviceTriggerInfo(dev);
+  printTriggerInputsInfoSnapshot(info);
+  freeDeviceInfo(info);
+}
 
-  // Name:
-  uint32_t length = DevGetName(dev, NULL, 0) + 1;
-  char deviceName[length];
-  length = DevGetName(dev, deviceName, length);
-  printf("  Name                      : %s" NEWLINE, deviceName);
+void printTriggerOutputsInfo(LibTiePieHandle_t dev)
+{
+  if(dev == LIBTIEPIE_HANDLE_INVALID)
+  {
+    fprintf(stderr, "Invalid device handle in printTriggerOutputsInfo()" NEWLINE);
+    return;
+  }
 
-  // Name short:
-  length = DevGetNameShort(dev, NULL, 0) + 1;
-  char deviceNameShort[length];
-  length = DevGetNameShort(dev, deviceNameShort, length);
-  printf("  Short name                : %s" NEWLINE, deviceNameShort);
+  DeviceInfo_t* info = getDeviceTriggerInfo(dev);
+  printTriggerOutputsInfoSnapshot(info);
+  freeDeviceInfo(info);
+}
 
-  printf("  Serial number             : %" PRIu32 NEWLINE, DevGetSerialNumber(dev));
+// Print functions rendering snapshots:
+void printLibraryInfoSnapshot(const LibraryInfo_t* info)
+{
+  printf("Library:" NEWLINE);
+
+  // Print library version:
+  printf("  Version: ");
+  printVersion(info->version);
+  printf("%s" NEWLINE, info->versionExtra);
+
+  // Print library configuration:
+  printf("  Configuration: 0x");
+  for(uint32_t i = 0; i < info->configLength; i++)
+    printf("%02" PRIx8, info->config[i]);
+  printf(NEWLINE);
+}
+
+void printDeviceInfoSnapshot(const DeviceInfo_t* info)
+{
+  printf("Device:" NEWLINE);
+  printf("  Name                      : %s" NEWLINE, info->name);
+  printf("  Short name                : %s" NEWLINE, info->nameShort);
+  printf("  Serial number             : %" PRIu32 NEWLINE, info->serialNumber);
 
   printf("  Calibration data          : ");
-  printDate(DevGetCalibrationDate(dev));
+  printDate(info->calibrationDate);
   printf(NEWLINE);
 
-  printf("  Product id                : %" PRIu32 NEWLINE, DevGetProductId(dev));
-  printf("  Vendor id                 : %" PRIu32 NEWLINE, DevGetVendorId(dev));
+  printf("  Product id                : %" PRIu32 NEWLINE, info->productId);
+  printf("  Vendor id                 : %" PRIu32 NEWLINE, info->vendorId);
 
-  const TpVersion_t driverVersion = DevGetDriverVersion(dev);
-  if(LibGetLastStatus() != LIBTIEPIESTATUS_NOT_SUPPORTED)
+  if(info->hasDriverVersion)
   {
     printf("  Driver version            : ");
-    printVersion(driverVersion);
+    printVersion(info->driverVersion);
     printf(NEWLINE);
   }
 
-  const TpVersion_t firmwareVersion = DevGetFirmwareVersion(dev);
-  if(LibGetLastStatus() != LIBTIEPIESTATUS_NOT_SUPPORTED)
+  if(info->hasFirmwareVersion)
   {
     printf("  Firmware version          : ");
-    printVersion(firmwareVersion);
+    printVersion(info->firmwareVersion);
     printf(NEWLINE);
   }
 
-  const uint32_t ipv4Address = DevGetIPv4Address(dev);
-  if(LibGetLastStatus() != LIBTIEPIESTATUS_NOT_SUPPORTED)
+  if(info->hasIPv4Address)
   {
     printf("  IPv4 address              : ");
-    printIPv4Address(ipv4Address);
+    printIPv4Address(info->ipv4Address);
     printf(NEWLINE);
   }
 
-  const uint16_t ipPort = DevGetIPPort(dev);
-  if(LibGetLastStatus() != LIBTIEPIESTATUS_NOT_SUPPORTED)
+  if(info->hasIPPort)
   {
-    printf("  IP port                   : %" PRIu16 NEWLINE, ipPort);
+    printf("  IP port                   : %" PRIu16 NEWLINE, info->ipPort);
   }
 
-  printf("  Has battery               : %s" NEWLINE, boolToStr(DevHasBattery(dev)));
+  printf("  Has battery               : %s" NEWLINE, boolToStr(info->hasBattery));
 
-  if(DevHasBattery(dev))
+  if(info->hasBattery)
   {
+    const BatteryInfo_t* battery = &info->battery;
+
     printf("  Battery:" NEWLINE);
 
-    const int8_t batteryCharge = DevGetBatteryCharge(dev);
-    if(LibGetLastStatus() != LIBTIEPIESTATUS_NOT_SUPPORTED)
-    {
-      printf("    Charge                  : %" PRIi8 " %%" NEWLINE, batteryCharge);
-    }
+    if(battery->hasCharge)
+      printf("    Charge                  : %" PRIi8 " %%" NEWLINE, battery->charge);
 
-    const int32_t batteryTimeToEmpty = DevGetBatteryTimeToEmpty(dev);
-    if(LibGetLastStatus() != LIBTIEPIESTATUS_NOT_SUPPORTED)
-    {
-      printf("    Time to empty           : %" PRIi32 " minutes" NEWLINE, batteryTimeToEmpty);
-    }
+    if(battery->hasTimeToEmpty)
+      printf("    Time to empty           : %" PRIi32 " minutes" NEWLINE, battery->timeToEmpty);
 
-    const int32_t batteryTimeToFull = DevGetBatteryTimeToFull(dev);
-    if(LibGetLastStatus() != LIBTIEPIESTATUS_NOT_SUPPORTED)
-    {
-      printf("    Time to full            : %" PRIi32 " minutes" NEWLINE, batteryTimeToFull);
-    }
+    if(battery->hasTimeToFull)
+      printf("    Time to full            : %" PRIi32 " minutes" NEWLINE, battery->timeToFull);
 
-    const uint16_t isBatteryChargerConnected = DevIsBatteryChargerConnected(dev);
-    if(LibGetLastStatus() != LIBTIEPIESTATUS_NOT_SUPPORTED)
-    {
-      printf("    Charger connected       : %s" NEWLINE, boolToStr(isBatteryChargerConnected));
-    }
+    if(battery->hasChargerConnected)
+      printf("    Charger connected       : %s" NEWLINE, boolToStr(battery->isChargerConnected));
 
-    const uint16_t isBatteryCharging = DevIsBatteryCharging(dev);
-    if(LibGetLastStatus() != LIBTIEPIESTATUS_NOT_SUPPORTED)
-    {
-      printf("    Charging                : %s" NEWLINE, boolToStr(isBatteryCharging));
-    }
+    if(battery->hasCharging)
+      printf("    Charging                : %s" NEWLINE, boolToStr(battery->isCharging));
 
-    const uint16_t isBatteryBroken = DevIsBatteryBroken(dev);
-    if(LibGetLastStatus() != LIBTIEPIESTATUS_NOT_SUPPORTED)
-    {
-      printf("    Broken                  : %s" NEWLINE, boolToStr(isBatteryBroken));
-    }
+    if(battery->hasBroken)
+      printf("    Broken                  : %s" NEWLINE, boolToStr(battery->isBroken));
   }
 
-  switch(DevGetType(dev))
+  switch(info->type)
   {
     case DEVICETYPE_OSCILLOSCOPE:
-      printOscilloscopeInfo(dev);
+      printOscilloscopeInfoSnapshot(info);
       break;
 
     case DEVICETYPE_GENERATOR:
-      printGeneratorInfo(dev);
+      printGeneratorInfoSnapshot(info);
       break;
 
     case DEVICETYPE_I2CHOST:
-      printI2CInfo(dev);
+      printI2CInfoSnapshot(info);
       break;
   }
 }
 
-void printOscilloscopeInfo(LibTiePieHandle_t scp)
+static void printDoubleList(const double* values, uint32_t count)
 {
-  if(scp == LIBTIEPIE_HANDLE_INVALID)
+  for(uint32_t i = 0; i < count; i++)
   {
-    fprintf(stderr, "Invalid device handle in printOscilloscopeInfo()" NEWLINE);
-    return;
+    if(i != 0)
+      printf(", ");
+
+    printf("%f", values[i]);
   }
+}
 
-  const uint16_t channelCount = ScpGetChannelCount(scp);
+void printOscilloscopeInfoSnapshot(const DeviceInfo_t* info)
+{
+  const OscilloscopeInfo_t* scp = &info->oscilloscope;
 
   printf("Oscilloscope:" NEWLINE);
-  printf("  Channel count             : %" PRIu16 NEWLINE, channelCount);
-  printf("  Connection test           : %s" NEWLINE, boolToStr(ScpHasConnectionTest(scp)));
+  printf("  Channel count             : %" PRIu16 NEWLINE, scp->channelCount);
+  printf("  Connection test           : %s" NEWLINE, boolToStr(scp->hasConnectionTest));
   printf("  Measure modes             : ");
-  printMeasureMode(ScpGetMeasureModes(scp));
+  printMeasureMode(scp->measureModes);
   printf(NEWLINE);
   printf("  Measure mode              : ");
-  printMeasureMode(ScpGetMeasureMode(scp));
+  printMeasureMode(scp->measureMode);
   printf(NEWLINE);
   printf("  Auto resolution modes     : ");
-  printAutoResolutionMode(ScpGetAutoResolutionModes(scp));
+  printAutoResolutionMode(scp->autoResolutionModes);
   printf(NEWLINE);
   printf("  Auto resolution mode      : ");
-  printAutoResolutionMode(ScpGetAutoResolutionMode(scp));
+  printAutoResolutionMode(scp->autoResolutionMode);
   printf(NEWLINE);
 
-  uint8_t resolutionCount = ScpGetResolutions(scp, NULL, 0);
-  uint8_t resolutions[sizeof(uint8_t) * resolutionCount];
-  resolutionCount = ScpGetResolutions(scp, resolutions, resolutionCount);
-
   printf("  Resolutions               : ");
-  for(uint8_t i = 0; i < resolutionCount; i++)
+  for(uint32_t i = 0; i < scp->resolutionCount; i++)
   {
     if(i != 0)
       printf(", ");
 
-    printf("%" PRIu8, resolutions[i]);
+    printf("%" PRIu8, scp->resolutions[i]);
   }
   printf(NEWLINE);
 
-  printf("  Resolution                : %" PRIu8 NEWLINE, ScpGetResolution(scp));
-  printf("  Resolution enhanced       : %s" NEWLINE, boolToStr(ScpIsResolutionEnhanced(scp)));
+  printf("  Resolution                : %" PRIu8 NEWLINE, scp->resolution);
+  printf("  Resolution enhanced       : %s" NEWLINE, boolToStr(scp->isResolutionEnhanced));
   printf("  Clock outputs             : ");
-  printClockOutput(ScpGetClockOutputs(scp));
+  printClockOutput(scp->clockOutputs);
   printf(NEWLINE);
   printf("  Clock output              : ");
-  printClockOutput(ScpGetClockOutput(scp));
+  printClockOutput(scp->clockOutput);
   printf(NEWLINE);
 
-  uint32_t clockOutputFrequencyCount = ScpGetClockOutputFrequencies(scp, NULL, 0);
-  if(clockOutputFrequencyCount > 0)
+  if(scp->clockOutputFrequencyCount > 0)
   {
-    double clockOutputFrequencies[sizeof(double) * clockOutputFrequencyCount];
-    clockOutputFrequencyCount = ScpGetClockOutputFrequencies(scp, clockOutputFrequencies, clockOutputFrequencyCount);
-
     printf("  Clock output frequencies  : ");
-    for(uint32_t i = 0; i < clockOutputFrequencyCount; i++)
-    {
-      if(i != 0)
-        printf(", ");
-
-      printf("%f", clockOutputFrequencies[i]);
-    }
+    printDoubleList(scp->clockOutputFrequencies, scp->clockOutputFrequencyCount);
     printf(NEWLINE);
-    printf("  Clock output frequency    : %f" NEWLINE, ScpGetClockOutputFrequency(scp));
+    printf("  Clock output frequency    : %f" NEWLINE, scp->clockOutputFrequency);
   }
 
   printf("  Clock sources             : ");
-  printClockSource(ScpGetClockSources(scp));
+  printClockSource(scp->clockSources);
   printf(NEWLINE);
   printf("  Clock source              : ");
-  printClockSource(ScpGetClockSource(scp));
+  printClockSource(scp->clockSource);
   printf(NEWLINE);
 
-  uint32_t clockSourceFrequencyCount = ScpGetClockSourceFrequencies(scp, NULL, 0);
-  if(clockSourceFrequencyCount > 0)
+  if(scp->clockSourceFrequencyCount > 0)
   {
-    double clockSourceFrequencies[sizeof(double) * clockSourceFrequencyCount];
-    clockSourceFrequencyCount = ScpGetClockSourceFrequencies(scp, clockSourceFrequencies, clockSourceFrequencyCount);
-
     printf("  Clock source frequencies  : ");
-    for(uint32_t i = 0; i < clockSourceFrequencyCount; i++)
-    {
-      if(i != 0)
-        printf(", ");
-
-      printf("%f", clockSourceFrequencies[i]);
-    }
+    printDoubleList(scp->clockSourceFrequencies, scp->clockSourceFrequencyCount);
     printf(NEWLINE);
-    printf("  Clock source frequency    : %f" NEWLINE, ScpGetClockSourceFrequency(scp));
+    printf("  Clock source frequency    : %f" NEWLINE, scp->clockSourceFrequency);
   }
 
-  printf("  Record length max         : %" PRIu64 NEWLINE, ScpGetRecordLengthMax(scp));
-  printf("  Record length             : %" PRIu64 NEWLINE, ScpGetRecordLength(scp));
-  printf("  Sample frequency max      : %f" NEWLINE, ScpGetSampleFrequencyMax(scp));
-  printf("  Sample frequency          : %f" NEWLINE, ScpGetSampleFrequency(scp));
+  printf("  Record length max         : %" PRIu64 NEWLINE, scp->recordLengthMax);
+  printf("  Record length             : %" PRIu64 NEWLINE, scp->recordLength);
+  printf("  Sample frequency max      : %f" NEWLINE, scp->sampleFrequencyMax);
+  printf("  Sample frequency          : %f" NEWLINE, scp->sampleFrequency);
 
-  if(ScpGetMeasureMode(scp) == MM_BLOCK)
+  if(scp->measureMode == MM_BLOCK)
   {
-    printf("  Segment count max         : %" PRIu32 NEWLINE, ScpGetSegmentCountMax(scp));
-    printf("  Segment count             : %" PRIu32 NEWLINE, ScpGetSegmentCount(scp));
+    printf("  Segment count max         : %" PRIu32 NEWLINE, scp->segmentCountMax);
+    printf("  Segment count             : %" PRIu32 NEWLINE, scp->segmentCount);
   }
 
-  if(ScpHasTrigger(scp))
+  if(scp->hasTrigger)
   {
-    printf("  Pre sample ratio          : %f" NEWLINE, ScpGetPreSampleRatio(scp));
+    printf("  Pre sample ratio          : %f" NEWLINE, scp->preSampleRatio);
 
-    double triggerTimeout = ScpGetTriggerTimeOut(scp);
     printf("  Trigger time out          : ");
-    if(triggerTimeout == TO_INFINITY)
+    if(scp->triggerTimeOut == TO_INFINITY)
       printf("Infinite" NEWLINE);
     else
-      printf("%f" NEWLINE, triggerTimeout);
+      printf("%f" NEWLINE, scp->triggerTimeOut);
 
-    if(ScpHasTriggerDelay(scp))
+    if(scp->hasTriggerDelay)
     {
-      printf("  Trigger delay max         : %f" NEWLINE, ScpGetTriggerDelayMax(scp));
-      printf("  Trigger delay             : %f" NEWLINE, ScpGetTriggerDelay(scp));
+      printf("  Trigger delay max         : %f" NEWLINE, scp->triggerDelayMax);
+      printf("  Trigger delay             : %f" NEWLINE, scp->triggerDelay);
     }
 
-    if(ScpHasTriggerHoldOff(scp))
+    if(scp->hasTriggerHoldOff)
     {
-      printf("  Trigger hold off count max: %" PRIu64 NEWLINE, ScpGetTriggerHoldOffCountMax(scp));
-      printf("  Trigger hold off count    : %" PRIu64 NEWLINE, ScpGetTriggerHoldOffCount(scp));
+      printf("  Trigger hold off count max: %" PRIu64 NEWLINE, scp->triggerHoldOffCountMax);
+      printf("  Trigger hold off count    : %" PRIu64 NEWLINE, scp->triggerHoldOffCount);
     }
   }
 
-  for(uint16_t ch = 0; ch < channelCount; ch++)
+  for(uint16_t ch = 0; ch < scp->channelCount; ch++)
   {
+    const ChannelInfo_t* channel = &scp->channels[ch];
+
     printf("  Channel%" PRIu16 ":" NEWLINE, (ch + 1));
     printf("    Connector type          : ");
-    printConnectorType(ScpChGetConnectorType(scp, ch));
+    printConnectorType(channel->connectorType);
     printf(NEWLINE);
-    printf("    Differential            : %s" NEWLINE, boolToStr(ScpChIsDifferential(scp, ch)));
-    printf("    Impedance               : %f" NEWLINE, ScpChGetImpedance(scp, ch));
-    printf("    Connection test         : %s" NEWLINE, boolToStr(ScpChHasConnectionTest(scp, ch)));
-    printf("    Available               : %s" NEWLINE, boolToStr(ScpChIsAvailable(scp, ch)));
-    printf("    Enabled                 : %s" NEWLINE, boolToStr(ScpChGetEnabled(scp, ch)));
-
-    uint32_t bandwidthCount = ScpChGetBandwidths(scp, ch, NULL, 0);
-    double bandwidths[sizeof(double) * bandwidthCount];
-    bandwidthCount = ScpChGetBandwidths(scp, ch, bandwidths, bandwidthCount);
+    printf("    Differential            : %s" NEWLINE, boolToStr(channel->isDifferential));
+    printf("    Impedance               : %f" NEWLINE, channel->impedance);
+    printf("    Connection test         : %s" NEWLINE, boolToStr(channel->hasConnectionTest));
+    printf("    Available               : %s" NEWLINE, boolToStr(channel->isAvailable));
+    printf("    Enabled                 : %s" NEWLINE, boolToStr(channel->isEnabled));
 
     printf("    Bandwidths              : ");
-    for(uint32_t i = 0; i < bandwidthCount; i++)
-    {
-      if(i != 0)
-        printf(", ");
-
-      printf("%f", bandwidths[i]);
-    }
+    printDoubleList(channel->bandwidths, channel->bandwidthCount);
     printf(NEWLINE);
-    printf("    Bandwidth               : %f" NEWLINE, ScpChGetBandwidth(scp, ch));
+    printf("    Bandwidth               : %f" NEWLINE, channel->bandwidth);
 
     printf("    Couplings               : ");
-    printCoupling(ScpChGetCouplings(scp, ch));
+    printCoupling(channel->couplings);
     printf(NEWLINE);
     printf("    Coupling                : ");
-    printCoupling(ScpChGetCoupling(scp, ch));
+    printCoupling(channel->coupling);
     printf(NEWLINE);
-    printf("    Auto ranging            : %s" NEWLINE, boolToStr(ScpChGetAutoRanging(scp, ch)));
-
-    uint32_t rangeCount = ScpChGetRanges(scp, ch, NULL, 0);
-    double ranges[sizeof(double) * rangeCount];
-    rangeCount = ScpChGetRanges(scp, ch, ranges, rangeCount);
+    printf("    Auto ranging            : %s" NEWLINE, boolToStr(channel->autoRanging));
 
     printf("    Ranges                  : ");
-    for(uint32_t i = 0; i < rangeCount; i++)
-    {
-      if(i != 0)
-        printf(", ");
-
-      printf("%f", ranges[i]);
-    }
+    printDoubleList(channel->ranges, channel->rangeCount);
     printf(NEWLINE);
 
-    printf("    Range                   : %f" NEWLINE, ScpChGetRange(scp, ch));
-    printf("    Probe gain              : %f" NEWLINE, ScpChGetProbeGain(scp, ch));
-    printf("    Probe offset            : %f" NEWLINE, ScpChGetProbeOffset(scp, ch));
-    if(ScpChHasSafeGround(scp, ch))
+    printf("    Range                   : %f" NEWLINE, channel->range);
+    printf("    Probe gain              : %f" NEWLINE, channel->probeGain);
+    printf("    Probe offset            : %f" NEWLINE, channel->probeOffset);
+    if(channel->hasSafeGround)
     {
-      printf("    SafeGround enabled      : %s" NEWLINE, boolToStr(ScpChGetSafeGroundEnabled(scp, ch)));
-      printf("    SafeGround threshold max: %f" NEWLINE, ScpChGetSafeGroundThresholdMax(scp, ch));
-      printf("    SafeGround threshold min: %f" NEWLINE, ScpChGetSafeGroundThresholdMin(scp, ch));
-      printf("    SafeGround threshold    : %f" NEWLINE, ScpChGetSafeGroundThreshold(scp, ch));
+      printf("    SafeGround enabled      : %s" NEWLINE, boolToStr(channel->safeGroundEnabled));
+      printf("    SafeGround threshold max: %f" NEWLINE, channel->safeGroundThresholdMax);
+      printf("    SafeGround threshold min: %f" NEWLINE, channel->safeGroundThresholdMin);
+      printf("    SafeGround threshold    : %f" NEWLINE, channel->safeGroundThreshold);
     }
 
-    if(ScpChHasTrigger(scp, ch))
+    if(channel->hasTrigger)
     {
+      const ChannelTriggerInfo_t* trigger = &channel->trigger;
+
       printf("  Trigger:" NEWLINE);
-      printf("    Available               : %s" NEWLINE, boolToStr(ScpChTrIsAvailable(scp, ch)));
-      printf("    Enabled                 : %s" NEWLINE, boolToStr(ScpChTrGetEnabled(scp, ch)));
+      printf("    Available               : %s" NEWLINE, boolToStr(trigger->isAvailable));
+      printf("    Enabled                 : %s" NEWLINE, boolToStr(trigger->isEnabled));
       printf("    Kinds                   : ");
-      printTriggerKind(ScpChTrGetKinds(scp, ch));
+      printTriggerKind(trigger->kinds);
       printf(NEWLINE);
       printf("    Kind                    : ");
-      printTriggerKind(ScpChTrGetKind(scp, ch));
+      printTriggerKind(trigger->kind);
       printf(NEWLINE);
       printf("    Level modes             : ");
-      printTriggerLevelMode(ScpChTrGetLevelModes(scp, ch));
+      printTriggerLevelMode(trigger->levelModes);
       printf(NEWLINE);
       printf("    Level mode              : ");
-      printTriggerLevelMode(ScpChTrGetLevelMode(scp, ch));
+      printTriggerLevelMode(trigger->levelMode);
       printf(NEWLINE);
 
-      const uint32_t triggerLevelCount = ScpChTrGetLevelCount(scp, ch);
       printf("    Levels                  : ");
-      for(uint32_t i = 0; i < triggerLevelCount; i++)
-      {
-        if(i != 0)
-          printf(", ");
-
-        printf("%f", ScpChTrGetLevel(scp, ch, i));
-      }
+      printDoubleList(trigger->levels, trigger->levelCount);
       printf(NEWLINE);
 
-      const uint32_t triggerHysteresisCount = ScpChTrGetHysteresisCount(scp, ch);
       printf("    Hystereses              : ");
-      for(uint32_t i = 0; i < triggerHysteresisCount; i++)
-      {
-        if(i != 0)
-          printf(", ");
-
-        printf("%f", ScpChTrGetHysteresis(scp, ch, i));
-      }
+      printDoubleList(trigger->hystereses, trigger->hysteresisCount);
       printf(NEWLINE);
 
       printf("    Conditions              : ");
-      printTriggerCondition(ScpChTrGetConditions(scp, ch));
+      printTriggerCondition(trigger->conditions);
       printf(NEWLINE);
-      if(ScpChTrGetConditions(scp, ch) != TCM_NONE)
+      if(trigger->conditions != TCM_NONE)
       {
         printf("    Condition               : ");
-        printTriggerCondition(ScpChTrGetCondition(scp, ch));
+        printTriggerCondition(trigger->condition);
         printf(NEWLINE);
       }
 
-      const uint32_t triggerTimeCount = ScpChTrGetTimeCount(scp, ch);
-      if(triggerTimeCount > 0)
+      if(trigger->timeCount > 0)
       {
         printf("    Times                   : ");
-        for(uint32_t i = 0; i < triggerTimeCount; i++)
-        {
-          if(i != 0)
-            printf(", ");
-
-          printf("%f" NEWLINE, ScpChTrGetTime(scp, ch, i));
-        }
+        printDoubleList(trigger->times, trigger->timeCount);
         printf(NEWLINE);
       }
     }
   }
 
-  printTriggerInputsInfo(scp);
-  printTriggerOutputsInfo(scp);
+  printTriggerInputsInfoSnapshot(info);
+  printTriggerOutputsInfoSnapshot(info);
 }
 
-void printGeneratorInfo(LibTiePieHandle_t gen)
+void printGeneratorInfoSnapshot(const DeviceInfo_t* info)
 {
-  if(gen == LIBTIEPIE_HANDLE_INVALID)
-  {
-    fprintf(stderr, "Invalid device handle in printGeneratorInfo()" NEWLINE);
-    return;
-  }
+  const GeneratorInfo_t* gen = &info->generator;
 
   printf("Generator:" NEWLINE);
   printf("  Connector type            : ");
-  printConnectorType(GenGetConnectorType(gen));
+  printConnectorType(gen->connectorType);
   printf(NEWLINE);
-  printf("  Differential              : %s" NEWLINE, boolToStr(GenIsDifferential(gen)));
-  printf("  Controllable              : %s" NEWLINE, boolToStr(GenIsControllable(gen)));
-  printf("  Impedance                 : %f" NEWLINE, GenGetImpedance(gen));
-  printf("  Resolution                : %" PRIu8 NEWLINE, GenGetResolution(gen));
-  printf("  Output value min          : %f" NEWLINE, GenGetOutputValueMin(gen));
-  printf("  Output value max          : %f" NEWLINE, GenGetOutputValueMax(gen));
-  printf("  Output on                 : %s" NEWLINE, boolToStr(GenGetOutputOn(gen)));
-  if(GenHasOutputInvert(gen))
+  printf("  Differential              : %s" NEWLINE, boolToStr(gen->isDifferential));
+  printf("  Controllable              : %s" NEWLINE, boolToStr(gen->isControllable));
+  printf("  Impedance                 : %f" NEWLINE, gen->impedance);
+  printf("  Resolution                : %" PRIu8 NEWLINE, gen->resolution);
+  printf("  Output value min          : %f" NEWLINE, gen->outputValueMin);
+  printf("  Output value max          : %f" NEWLINE, gen->outputValueMax);
+  printf("  Output on                 : %s" NEWLINE, boolToStr(gen->outputOn));
+  if(gen->hasOutputInvert)
   {
-    printf("  Output invert             : %s" NEWLINE, boolToStr(GenGetOutputInvert(gen)));
+    printf("  Output invert             : %s" NEWLINE, boolToStr(gen->outputInvert));
   }
 
   printf("  Modes native              : ");
-  printGeneratorMode(GenGetModesNative(gen));
+  printGeneratorMode(gen->modesNative);
   printf(NEWLINE);
   printf("  Modes                     : ");
-  printGeneratorMode(GenGetModes(gen));
+  printGeneratorMode(gen->modes);
   printf(NEWLINE);
-  if(GenGetModes(gen) != GMM_NONE)
+  if(gen->modes != GMM_NONE)
   {
     printf("  Burst mode                : ");
-    printGeneratorMode(GenGetMode(gen));
+    printGeneratorMode(gen->mode);
     printf(NEWLINE);
-    if(GenGetMode(gen) & GMM_BURST_COUNT)
+    if(gen->mode & GMM_BURST_COUNT)
     {
-      printf("  Burst active              : %s" NEWLINE, boolToStr(GenIsBurstActive(gen)));
-      printf("  Burst count max           : %" PRIu64 NEWLINE, GenGetBurstCountMax(gen));
-      printf("  Burst count               : %" PRIu64 NEWLINE, GenGetBurstCount(gen));
+      printf("  Burst active              : %s" NEWLINE, boolToStr(gen->isBurstActive));
+      printf("  Burst count max           : %" PRIu64 NEWLINE, gen->burstCountMax);
+      printf("  Burst count               : %" PRIu64 NEWLINE, gen->burstCount);
     }
-    if(GenGetMode(gen) & GMM_BURST_SAMPLE_COUNT)
+    if(gen->mode & GMM_BURST_SAMPLE_COUNT)
     {
-      printf("  Burst sample max          : %" PRIu64 NEWLINE, GenGetBurstSampleCountMax(gen));
-      printf("  Burst sample              : %" PRIu64 NEWLINE, GenGetBurstSampleCount(gen));
+      printf("  Burst sample max          : %" PRIu64 NEWLINE, gen->burstSampleCountMax);
+      printf("  Burst sample              : %" PRIu64 NEWLINE, gen->burstSampleCount);
     }
-    if(GenGetMode(gen) & GMM_BURST_SEGMENT_COUNT)
+    if(gen->mode & GMM_BURST_SEGMENT_COUNT)
     {
-      printf("  Burst segment max         : %" PRIu64 NEWLINE, GenGetBurstSegmentCountMax(gen));
-      printf("  Burst segment             : %" PRIu64 NEWLINE, GenGetBurstSegmentCount(gen));
+      printf("  Burst segment max         : %" PRIu64 NEWLINE, gen->burstSegmentCountMax);
+      printf("  Burst segment             : %" PRIu64 NEWLINE, gen->burstSegmentCount);
     }
   }
 
   printf("  Signal types              : ");
-  printSignalType(GenGetSignalTypes(gen));
+  printSignalType(gen->signalTypes);
   printf(NEWLINE);
   printf("  Signal type               : ");
-  printSignalType(GenGetSignalType(gen));
+  printSignalType(gen->signalType);
   printf(NEWLINE);
 
-  if(GenHasAmplitude(gen))
+  if(gen->hasAmplitude)
   {
-    printf("  Amplitude min             : %f" NEWLINE, GenGetAmplitudeMin(gen));
-    printf("  Amplitude max             : %f" NEWLINE, GenGetAmplitudeMax(gen));
-    printf("  Amplitude                 : %f" NEWLINE, GenGetAmplitude(gen));
-
-    uint32_t rangeCount = GenGetAmplitudeRanges(gen, NULL, 0);
-    double ranges[sizeof(double) * rangeCount];
-    rangeCount = GenGetAmplitudeRanges(gen, ranges, rangeCount);
+    printf("  Amplitude min             : %f" NEWLINE, gen->amplitudeMin);
+    printf("  Amplitude max             : %f" NEWLINE, gen->amplitudeMax);
+    printf("  Amplitude                 : %f" NEWLINE, gen->amplitude);
 
     printf("  Amplitude ranges          : ");
-    for(uint32_t i = 0; i < rangeCount; i++)
-    {
-      if(i != 0)
-        printf(", ");
-
-      printf("%f", ranges[i]);
-    }
+    printDoubleList(gen->amplitudeRanges, gen->amplitudeRangeCount);
     printf(NEWLINE);
 
-    printf("  Amplitude range           : %f" NEWLINE, GenGetAmplitudeRange(gen));
-    printf("  Amplitude auto ranging    : %s" NEWLINE, boolToStr(GenGetAmplitudeAutoRanging(gen)));
+    printf("  Amplitude range           : %f" NEWLINE, gen->amplitudeRange);
+    printf("  Amplitude auto ranging    : %s" NEWLINE, boolToStr(gen->amplitudeAutoRanging));
   }
 
-  if(GenHasFrequency(gen))
+  if(gen->hasFrequency)
   {
     printf("  Frequency modes           : ");
-    printFrequencyMode(GenGetFrequencyModes(gen));
+    printFrequencyMode(gen->frequencyModes);
     printf(NEWLINE);
     printf("  Frequency mode            : ");
-    printFrequencyMode(GenGetFrequencyMode(gen));
+    printFrequencyMode(gen->frequencyMode);
     printf(NEWLINE);
-    printf("  Frequency min             : %f" NEWLINE, GenGetFrequencyMin(gen));
-    printf("  Frequency max             : %f" NEWLINE, GenGetFrequencyMax(gen));
-    printf("  Frequency                 : %f" NEWLINE, GenGetFrequency(gen));
+    printf("  Frequency min             : %f" NEWLINE, gen->frequencyMin);
+    printf("  Frequency max             : %f" NEWLINE, gen->frequencyMax);
+    printf("  Frequency                 : %f" NEWLINE, gen->frequency);
   }
 
-  if(GenHasOffset(gen))
+  if(gen->hasOffset)
   {
-    printf("  Offset min                : %f" NEWLINE, GenGetOffsetMin(gen));
-    printf("  Offset max                : %f" NEWLINE, GenGetOffsetMax(gen));
-    printf("  Offset                    : %f" NEWLINE, GenGetOffset(gen));
+    printf("  Offset min                : %f" NEWLINE, gen->offsetMin);
+    printf("  Offset max                : %f" NEWLINE, gen->offsetMax);
+    printf("  Offset                    : %f" NEWLINE, gen->offset);
   }
 
-  if(GenHasPhase(gen))
+  if(gen->hasPhase)
   {
-    printf("  Phase min                 : %f" NEWLINE, GenGetPhaseMin(gen));
-    printf("  Phase max                 : %f" NEWLINE, GenGetPhaseMax(gen));
-    printf("  Phase                     : %f" NEWLINE, GenGetPhase(gen));
+    printf("  Phase min                 : %f" NEWLINE, gen->phaseMin);
+    printf("  Phase max                 : %f" NEWLINE, gen->phaseMax);
+    printf("  Phase                     : %f" NEWLINE, gen->phase);
   }
 
-  if(GenHasSymmetry(gen))
+  if(gen->hasSymmetry)
   {
-    printf("  Symmetry min              : %f" NEWLINE, GenGetSymmetryMin(gen));
-    printf("  Symmetry max              : %f" NEWLINE, GenGetSymmetryMax(gen));
-    printf("  Symmetry                  : %f" NEWLINE, GenGetSymmetry(gen));
+    printf("  Symmetry min              : %f" NEWLINE, gen->symmetryMin);
+    printf("  Symmetry max              : %f" NEWLINE, gen->symmetryMax);
+    printf("  Symmetry                  : %f" NEWLINE, gen->symmetry);
   }
 
-  if(GenHasWidth(gen))
+  if(gen->hasWidth)
   {
-    printf("  Width min                 : %f" NEWLINE, GenGetWidthMin(gen));
-    printf("  Width max                 : %f" NEWLINE, GenGetWidthMax(gen));
-    printf("  Width                     : %f" NEWLINE, GenGetWidth(gen));
+    printf("  Width min                 : %f" NEWLINE, gen->widthMin);
+    printf("  Width max                 : %f" NEWLINE, gen->widthMax);
+    printf("  Width                     : %f" NEWLINE, gen->width);
   }
 
-  if(GenHasEdgeTime(gen))
+  if(gen->hasEdgeTime)
   {
-    printf("  Leading edge time min     : %f" NEWLINE, GenGetLeadingEdgeTimeMax(gen));
-    printf("  Leading edge time max     : %f" NEWLINE, GenGetLeadingEdgeTimeMin(gen));
-    printf("  Leading edge time         : %f" NEWLINE, GenGetLeadingEdgeTime(gen));
-    printf("  Trailing edge time min    : %f" NEWLINE, GenGetTrailingEdgeTimeMax(gen));
-    printf("  Trailing edge time max    : %f" NEWLINE, GenGetTrailingEdgeTimeMin(gen));
-    printf("  Trailing edge time        : %f" NEWLINE, GenGetTrailingEdgeTime(gen));
+    printf("  Leading edge time min     : %f" NEWLINE, gen->leadingEdgeTimeMin);
+    printf("  Leading edge time max     : %f" NEWLINE, gen->leadingEdgeTimeMax);
+    printf("  Leading edge time         : %f" NEWLINE, gen->leadingEdgeTime);
+    printf("  Trailing edge time min    : %f" NEWLINE, gen->trailingEdgeTimeMin);
+    printf("  Trailing edge time max    : %f" NEWLINE, gen->trailingEdgeTimeMax);
+    printf("  Trailing edge time        : %f" NEWLINE, gen->trailingEdgeTime);
   }
 
-  if(GenHasData(gen))
+  if(gen->hasData)
   {
-    printf("  DataLength min            : %" PRIu64 NEWLINE, GenGetDataLengthMin(gen));
-    printf("  DataLength max            : %" PRIu64 NEWLINE, GenGetDataLengthMax(gen));
-    printf("  DataLength                : %" PRIu64 NEWLINE, GenGetDataLength(gen));
+    printf("  DataLength min            : %" PRIu64 NEWLINE, gen->dataLengthMin);
+    printf("  DataLength max            : %" PRIu64 NEWLINE, gen->dataLengthMax);
+    printf("  DataLength                : %" PRIu64 NEWLINE, gen->dataLength);
   }
 
-  printTriggerInputsInfo(gen);
-  printTriggerOutputsInfo(gen);
+  printTriggerInputsInfoSnapshot(info);
+  printTriggerOutputsInfoSnapshot(info);
 }
 
-void printI2CInfo(LibTiePieHandle_t i2c)
+void printI2CInfoSnapshot(const DeviceInfo_t* info)
 {
-  if(i2c == LIBTIEPIE_HANDLE_INVALID)
-  {
-    fprintf(stderr, "Invalid device handle in printI2CInfo()" NEWLINE);
-    return;
-  }
+  const I2CInfo_t* i2c = &info->i2c;
 
   printf("I2C Host:" NEWLINE);
 
-  uint32_t internalAddressCount = I2CGetInternalAddresses(i2c, NULL, 0);
-  uint16_t internalAddresses[sizeof(uint16_t) * internalAddressCount];
-  internalAddressCount = I2CGetInternalAddresses(i2c, internalAddresses, internalAddressCount);
-
   printf("  Internal addresses        : ");
-  for(uint32_t i = 0; i < internalAddressCount; i++)
+  for(uint32_t i = 0; i < i2c->internalAddressCount; i++)
   {
     if(i != 0)
       printf(", ");
 
-    printf("%u", internalAddresses[i]);
+    printf("%u", i2c->internalAddresses[i]);
   }
   printf(NEWLINE);
 
-  printf("  Speed max                 : %f" NEWLINE, I2CGetSpeedMax(i2c));
-  printf("  Speed                     : %f" NEWLINE, I2CGetSpeed(i2c));
+  printf("  Speed max                 : %f" NEWLINE, i2c->speedMax);
+  printf("  Speed                     : %f" NEWLINE, i2c->speed);
 
-  printTriggerInputsInfo(i2c);
-  printTriggerOutputsInfo(i2c);
+  printTriggerInputsInfoSnapshot(info);
+  printTriggerOutputsInfoSnapshot(info);
 }
 
-void printServerInfo(LibTiePieHandle_t srv)
+void printServerInfoSnapshot(const ServerInfo_t* info)
 {
-  if(srv == LIBTIEPIE_HANDLE_INVALID)
-  {
-    fprintf(stderr, "Invalid server handle in printServerInfo()" NEWLINE);
-    return;
-  }
-
   printf("Server:" NEWLINE);
-
-  uint32_t length = SrvGetURL(srv, NULL, 0) + 1;
-  char url[length];
-  SrvGetURL(srv, url, length);
-  printf("  URL                       : %s" NEWLINE, url);
-
-  length = SrvGetName(srv, NULL, 0) + 1;
-  char name[length];
-  SrvGetName(srv, name, length);
-  printf("  Name                      : %s" NEWLINE, name);
-
-  length = SrvGetDescription(srv, NULL, 0) + 1;
-  char description[length];
-  SrvGetDescription(srv, description, length);
-  printf("  Description               : %s" NEWLINE, description);
+  printf("  URL                       : %s" NEWLINE, info->url);
+  printf("  Name                      : %s" NEWLINE, info->name);
+  printf("  Description               : %s" NEWLINE, info->description);
 
   printf("  IPv4 address              : ");
-  printIPv4Address(SrvGetIPv4Address(srv));
+  printIPv4Address(info->ipv4Address);
   printf(NEWLINE);
 
-  printf("  IP port                   : %" PRIu16 NEWLINE, SrvGetIPPort(srv));
-
-  length = SrvGetID(srv, NULL, 0) + 1;
-  char id[length];
-  SrvGetID(srv, id, length);
-  printf("  Id                        : %s" NEWLINE, id);
+  printf("  IP port                   : %" PRIu16 NEWLINE, info->ipPort);
+  printf("  Id                        : %s" NEWLINE, info->id);
 
   printf("  Version                   : ");
-  printVersion(SrvGetVersion(srv));
+  printVersion(info->version);
   printf(NEWLINE);
 
-  printf("  Status                    : %s" NEWLINE, ServerStatuses[SrvGetStatus(srv)]);
+  printf("  Status                    : %s" NEWLINE, ServerStatuses[info->status]);
 
-  if(SrvGetLastError(srv) != LIBTIEPIE_SERVER_ERROR_NONE)
-    printf("  Last error                : %s" NEWLINE, ServerErrorCodes[SrvGetLastError(srv)]);
+  if(info->lastError != LIBTIEPIE_SERVER_ERROR_NONE)
+    printf("  Last error                : %s" NEWLINE, ServerErrorCodes[info->lastError]);
 }
 
-void printTriggerInputsInfo(LibTiePieHandle_t dev)
+void printTriggerInputsInfoSnapshot(const DeviceInfo_t* info)
 {
-  if(dev == LIBTIEPIE_HANDLE_INVALID)
+  for(uint16_t i = 0; i < info->triggerInputCount; i++)
   {
-    fprintf(stderr, "Invalid device handle in printTriggerInputsInfo()" NEWLINE);
-    return;
-  }
-
-  const uint16_t count = DevTrGetInputCount(dev);
+    const TriggerInputInfo_t* input = &info->triggerInputs[i];
 
-  for(uint16_t i = 0; i < count; i++)
-  {
     printf("  TriggerInput %" PRIu16 ":" NEWLINE, i);
-    printf("    Id                      : %" PRIu32 NEWLINE, DevTrInGetId(dev, i));
-
-    uint32_t length = DevTrInGetName(dev, i, NULL, 0) + 1;
-    char name[sizeof(char) * length];
-    length = DevTrInGetName(dev, i, name, length);
-    printf("    Name                    : %s" NEWLINE, name);
-
-    printf("    Available               : %s" NEWLINE, boolToStr(DevTrInIsAvailable(dev, i)));
-    if(DevTrInIsAvailable(dev, i))
+    printf("    Id                      : %" PRIu32 NEWLINE, input->id);
+    printf("    Name                    : %s" NEWLINE, input->name);
+    printf("    Available               : %s" NEWLINE, boolToStr(input->isAvailable));
+    if(input->isAvailable)
     {
-      printf("    Enabled                 : %s" NEWLINE, boolToStr(DevTrInGetEnabled(dev, i)));
+      printf("    Enabled                 : %s" NEWLINE, boolToStr(input->isEnabled));
       printf("    Kinds                   : ");
-      printTriggerKind(DevTrInGetKinds(dev, i));
+      printTriggerKind(input->kinds);
       printf(NEWLINE);
-      if(DevTrInGetKinds(dev, i) != TKM_NONE)
+      if(input->kinds != TKM_NONE)
       {
         printf("    Kind                    : ");
-        printTriggerKind(DevTrInGetKind(dev, i));
+        printTriggerKind(input->kind);
         printf(NEWLINE);
       }
     }
   }
 }
 
-void printTriggerOutputsInfo(LibTiePieHandle_t dev)
+void printTriggerOutputsInfoSnapshot(const DeviceInfo_t* info)
 {
-  if(dev == LIBTIEPIE_HANDLE_INVALID)
+  for(uint16_t i = 0; i < info->triggerOutputCount; i++)
   {
-    fprintf(stderr, "Invalid device handle in printTriggerOutputsInfo()" NEWLINE);
-    return;
-  }
-
-  const uint16_t count = DevTrGetOutputCount(dev);
+    const TriggerOutputInfo_t* output = &info->triggerOutputs[i];
 
-  for(uint16_t i = 0; i < count; i++)
-  {
     printf("  TriggerOutput %" PRIu16 ":" NEWLINE, i);
-    printf("    Id                      : %" PRIu32 NEWLINE, DevTrOutGetId(dev, i));
-
-    uint32_t length = DevTrOutGetName(dev, i, NULL, 0) + 1;
-    char name[sizeof(char) * length];
-    length = DevTrOutGetName(dev, i, name, length);
-    printf("    Name                    : %s" NEWLINE, name);
-
-    printf("    Enabled                 : %s" NEWLINE, boolToStr(DevTrOutGetEnabled(dev, i)));
+    printf("    Id                      : %" PRIu32 NEWLINE, output->id);
+    printf("    Name                    : %s" NEWLINE, output->name);
+    printf("    Enabled                 : %s" NEWLINE, boolToStr(output->isEnabled));
     printf("    Events                  : ");
-    printTriggerOutputEvent(DevTrOutGetEvents(dev, i));
+    printTriggerOutputEvent(output->events);
     printf(NEWLINE);
     printf("    Event                   : ");
-    printTriggerOutputEvent(DevTrOutGetEvent(dev, i));
+    printTriggerOutputEvent(output->event);
     printf(NEWLINE);
   }
 }
@@ -1058,3 +993,21 @@ const char* boolToStr(bool8_t value)
 {
   return (value == BOOL8_FALSE) ? "false" : "true";
 }
+
+const char* triStateToStr(LibTiePieTriState_t value)
+{
+  switch(value)
+  {
+    case LIBTIEPIE_TRISTATE_UNDEFINED:
+      return "undefined";
+
+    case LIBTIEPIE_TRISTATE_FALSE:
+      return "false";
+
+    case LIBTIEPIE_TRISTATE_TRUE:
+      return "true";
+
+    default:
+      return "unknown";
+  }
+}
@@ -10,6 +10,25 @@
 #define _PRINTINFO_H_
 
 #include <libtiepie.h>
+#include "DeviceInfo.h"
+
+// String tables for special values/types, indexed by bit number:
+extern const char* GeneratorModes[GMN_COUNT];
+extern const char* ClockOutputTypes[CON_COUNT];
+extern const char* ClockSources[CSN_COUNT];
+extern const char* ConnectorTypes[CONNECTORTYPE_COUNT];
+extern const char* Couplings[CKN_COUNT];
+extern const char* DeviceTypes[DEVICETYPE_COUNT];
+extern const char* FrequencyModes[FMN_COUNT];
+extern const char* MeasureModes[MMN_COUNT];
+extern const char* AutoResolutionModes[ARN_COUNT];
+extern const char* SignalTypes[STN_COUNT];
+extern const char* TriggerConditions[TCN_COUNT];
+extern const char* TriggerKinds[TKN_COUNT];
+extern const char* TriggerLevelModes[TLMN_COUNT];
+extern const char* TriggerOutputEvents[TOEN_COUNT];
+extern const char* ServerErrorCodes[];
+extern const char* ServerStatuses[];
 
 // Print library info:
 void printLibraryInfo();
@@ -35,6 +54,17 @@ void printTriggerInputsInfo(LibTiePieHandle_t dev);
 // Print trigger output info:
 void printTriggerOutputsInfo(LibTiePieHandle_t dev);
 
+// Print functions rendering snapshots, these don't access the device.
+// To print several parts of a device, gather once with getDeviceInfo() and render each part from that snapshot:
+void printLibraryInfoSnapshot(const LibraryInfo_t* info);
+void printDeviceInfoSnapshot(const DeviceInfo_t* info);
+void printOscilloscopeInfoSnapshot(const DeviceInfo_t* info);
+void printGeneratorInfoSnapshot(const DeviceInfo_t* info);
+void printI2CInfoSnapshot(const DeviceInfo_t* info);
+void printServerInfoSnapshot(const ServerInfo_t* info);
+void printTriggerInputsInfoSnapshot(const DeviceInfo_t* info);
+void printTriggerOutputsInfoSnapshot(const DeviceInfo_t* info);
+
 // Print functions for special values/types:
 void printGeneratorMode(uint64_t generatorModes);
 void printClockOutput(uint32_t clockOutputs);
@@ -56,5 +86,6 @@ void printIPv4Address(uint32_t ipv4Address);
 
 // String conversion functions:
 const char* boolToStr(bool8_t value);
+const char* triStateToStr(LibTiePieTriState_t value);
 
 #endif
@@ -0,0 +1,80 @@
+/**
+ * Queue.c
+ *
+ * This file is part of the LibTiePie programming examples.
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#include "Queue.h"
+#include <stdlib.h>
+
+bool8_t queueInit(Queue_t* queue, unsigned int capacity)
+{
+  queue->items = malloc(sizeof(void*) * capacity);
+  if(!queue->items)
+    return BOOL8_FALSE;
+
+  queue->capacity = capacity;
+  queue->head = 0;
+  queue->count = 0;
+  queue->closed = BOOL8_FALSE;
+  pthread_mutex_init(&queue->lock, NULL);
+  pthread_cond_init(&queue->notEmpty, NULL);
+  pthread_cond_init(&queue->notFull, NULL);
+
+  return BOOL8_TRUE;
+}
+
+void queueFree(Queue_t* queue)
+{
+  pthread_cond_destroy(&queue->notFull);
+  pthread_cond_destroy(&queue->notEmpty);
+  pthread_mutex_destroy(&queue->lock);
+  free(queue->items);
+  queue->items = NULL;
+}
+
+void queuePush(Queue_t* queue, void* item)
+{
+  pthread_mutex_lock(&queue->lock);
+
+  while(queue->count == queue->capacity)
+    pthread_cond_wait(&queue->notFull, &queue->lock);
+
+  queue->items[(queue->head + queue->count) % queue->capacity] = item;
+  queue->count++;
+
+  pthread_cond_signal(&queue->notEmpty);
+  pthread_mutex_unlock(&queue->lock);
+}
+
+void* queuePop(Queue_t* queue)
+{
+  void* item = NULL;
+
+  pthread_mutex_lock(&queue->lock);
+
+  while(queue->count == 0 && !queue->closed)
+    pthread_cond_wait(&queue->notEmpty, &queue->lock);
+
+  if(queue->count > 0)
+  {
+    item = queue->items[queue->head];
+    queue->head = (queue->head + 1) % queue->capacity;
+    queue->count--;
+    pthread_cond_signal(&queue->notFull);
+  }
+
+  pthread_mutex_unlock(&queue->lock);
+
+  return item;
+}
+
+void queueClose(Queue_t* queue)
+{
+  pthread_mutex_lock(&queue->lock);
+  queue->closed = BOOL8_TRUE;
+  pthread_cond_broadcast(&queue->notEmpty);
+  pthread_mutex_unlock(&queue->lock);
+}
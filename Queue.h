@@ -0,0 +1,43 @@
+/**
+ * Queue.h
+ *
+ * This file is part of the LibTiePie programming examples.
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#ifndef _QUEUE_H_
+#define _QUEUE_H_
+
+#include <pthread.h>
+#include <libtiepie.h>
+
+// Bounded first in, first out queue of pointers to pass work between threads.
+// A pool of buffers is a queue filled with the free buffers: take one with queuePop(), give it back with queuePush().
+
+typedef struct
+{
+  void** items;
+  unsigned int capacity;
+  unsigned int head;
+  unsigned int count;
+  bool8_t closed;
+  pthread_mutex_t lock;
+  pthread_cond_t notEmpty;
+  pthread_cond_t notFull;
+} Queue_t;
+
+// Returns BOOL8_FALSE if out of memory:
+bool8_t queueInit(Queue_t* queue, unsigned int capacity);
+void queueFree(Queue_t* queue);
+
+// Add an item, waits while the queue is full:
+void queuePush(Queue_t* queue, void* item);
+
+// Remove the oldest item, waits while the queue is empty. Returns NULL when the queue is closed and empty:
+void* queuePop(Queue_t* queue);
+
+// No more items will be pushed, wakes up waiting readers:
+void queueClose(Queue_t* queue);
+
+#endif
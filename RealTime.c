@@ -0,0 +1,116 @@
+/**
+ * RealTime.c
+ *
+ * This file is part of the LibTiePie programming examples.
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#include "RealTime.h"
+#include "Utils.h"
+#ifdef OS_WINDOWS
+#  include <windows.h>
+#else // POSIX
+#  include <pthread.h>
+#  include <sched.h>
+#  include <unistd.h>
+#  include <sys/mman.h>
+#endif
+
+bool8_t realTimeSetPriority(int priority)
+{
+#ifdef OS_WINDOWS
+  (void)priority;
+
+  return SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_TIME_CRITICAL) ? BOOL8_TRUE : BOOL8_FALSE;
+#else // POSIX
+  struct sched_param param;
+  param.sched_priority = priority;
+
+  return pthread_setschedparam(pthread_self(), SCHED_FIFO, &param) == 0 ? BOOL8_TRUE : BOOL8_FALSE;
+#endif
+}
+
+bool8_t realTimeSetCpu(unsigned int cpu)
+{
+  if(cpu >= getProcessorCount())
+    return BOOL8_FALSE;
+
+#ifdef OS_WINDOWS
+  if(cpu >= sizeof(DWORD_PTR) * 8)
+    return BOOL8_FALSE;
+
+  return SetThreadAffinityMask(GetCurrentThread(), (DWORD_PTR)1 << cpu) != 0 ? BOOL8_TRUE : BOOL8_FALSE;
+#elif defined(__linux__)
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(cpu, &set);
+
+  return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0 ? BOOL8_TRUE : BOOL8_FALSE;
+#else // No thread affinity.
+  return BOOL8_FALSE;
+#endif
+}
+
+bool8_t realTimeAvoidCpu(unsigned int cpu)
+{
+  const unsigned int count = getProcessorCount();
+
+  if(count < 2 || cpu >= count)
+    return BOOL8_FALSE;
+
+#ifdef OS_WINDOWS
+  DWORD_PTR mask = 0;
+  for(unsigned int i = 0; i < count && i < sizeof(DWORD_PTR) * 8; i++)
+  {
+    if(i != cpu)
+      mask |= (DWORD_PTR)1 << i;
+  }
+
+  return SetThreadAffinityMask(GetCurrentThread(), mask) != 0 ? BOOL8_TRUE : BOOL8_FALSE;
+#elif defined(__linux__)
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  for(unsigned int i = 0; i < count && i < CPU_SETSIZE; i++)
+  {
+    if(i != cpu)
+      CPU_SET(i, &set);
+  }
+
+  return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0 ? BOOL8_TRUE : BOOL8_FALSE;
+#else // No thread affinity.
+  return BOOL8_FALSE;
+#endif
+}
+
+bool8_t realTimeLockMemory(void* data, size_t size)
+{
+#ifdef OS_WINDOWS
+  const bool8_t locked = VirtualLock(data, size) ? BOOL8_TRUE : BOOL8_FALSE;
+  SYSTEM_INFO info;
+  GetSystemInfo(&info);
+  const size_t pageSize = info.dwPageSize;
+#else // POSIX
+  const bool8_t locked = mlock(data, size) == 0 ? BOOL8_TRUE : BOOL8_FALSE;
+  const long pageSizeValue = sysconf(_SC_PAGESIZE);
+  const size_t pageSize = pageSizeValue > 0 ? (size_t)pageSizeValue : 4096;
+#endif
+
+  // Touch every page without changing the contents, to map it:
+  volatile uint8_t* bytes = data;
+  for(size_t i = 0; i < size; i += pageSize)
+    bytes[i] = bytes[i];
+  if(size > 0)
+    bytes[size - 1] = bytes[size - 1];
+
+  return locked;
+}
+
+void realTimeUnlockMemory(void* data, size_t size)
+{
+#ifdef OS_WINDOWS
+  VirtualUnlock(data, size);
+#else // POSIX
+  munlock(data, size);
+#endif
+}
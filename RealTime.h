@@ -0,0 +1,38 @@
+/**
+ * RealTime.h
+ *
+ * This file is part of the LibTiePie programming examples.
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#ifndef _REALTIME_H_
+#define _REALTIME_H_
+
+#include <stddef.h>
+#include <libtiepie.h>
+
+// Real-time profile for time critical threads, e.g. the thread reading stream data.
+// All functions return BOOL8_FALSE if not supported or not permitted, e.g. SCHED_FIFO needs root or CAP_SYS_NICE on Linux.
+
+typedef struct
+{
+  bool8_t enabled;
+  int priority; // SCHED_FIFO priority, 1..99.
+  unsigned int cpu; // Processor for the time critical thread.
+} RealTimeProfile_t;
+
+// Run the calling thread with real-time priority, SCHED_FIFO on POSIX and time critical on Windows:
+bool8_t realTimeSetPriority(int priority);
+
+// Run the calling thread on processor cpu only:
+bool8_t realTimeSetCpu(unsigned int cpu);
+
+// Run the calling thread on all processors except cpu, for threads that shouldn't disturb a time critical thread:
+bool8_t realTimeAvoidCpu(unsigned int cpu);
+
+// Lock memory in RAM and touch every page, so accessing it later never causes a page fault. Pages are touched also if locking fails:
+bool8_t realTimeLockMemory(void* data, size_t size);
+void realTimeUnlockMemory(void* data, size_t size);
+
+#endif
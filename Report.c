@@ -0,0 +1,786 @@
+/**
+ * Report.c
+ *
+ * This file is part of the LibTiePie programming examples.
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#include "Report.h"
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <inttypes.h>
+#include "PrintInfo.h" // for the string tables
+#include "Utils.h"
+#ifdef OS_WINDOWS
+#  include <io.h>
+#  include <fcntl.h>
+#  define write _write
+#else // POSIX
+#  include <unistd.h>
+#endif
+
+// CBOR major types:
+#define CBOR_UINT   0x00
+#define CBOR_NEGINT 0x20
+#define CBOR_BYTES  0x40
+#define CBOR_TEXT   0x60
+#define CBOR_ARRAY  0x80
+#define CBOR_MAP    0xa0
+#define CBOR_FALSE  0xf4
+#define CBOR_TRUE   0xf5
+#define CBOR_NULL   0xf6
+#define CBOR_DOUBLE 0xfb
+#define CBOR_INDEFINITE 0x1f
+#define CBOR_BREAK  0xff
+
+void reportInit(Report_t* report, int format)
+{
+  memset(report, 0, sizeof(Report_t));
+  report->format = format;
+  report->first[0] = BOOL8_TRUE;
+}
+
+void reportFree(Report_t* report)
+{
+  free(report->data);
+  report->data = NULL;
+  report->length = 0;
+  report->capacity = 0;
+}
+
+static void reserve(Report_t* report, size_t length)
+{
+  if(report->length + length > report->capacity)
+  {
+    size_t capacity = report->capacity ? report->capacity : 4096;
+    while(report->length + length > capacity)
+      capacity *= 2;
+
+    char* data = realloc(report->data, capacity);
+    if(!data)
+    {
+      fprintf(stderr, "Out of memory in report" NEWLINE);
+      exit(EXIT_FAILURE);
+    }
+
+    report->data = data;
+    report->capacity = capacity;
+  }
+}
+
+static void append(Report_t* report, const void* data, size_t length)
+{
+  reserve(report, length);
+  memcpy(report->data + report->length, data, length);
+  report->length += length;
+}
+
+static void appendByte(Report_t* report, uint8_t value)
+{
+  append(report, &value, 1);
+}
+
+bool8_t reportWrite(Report_t* report, FILE* file)
+{
+  // The document is written in binary mode, so a plain line feed:
+  if(report->format == REPORT_JSON)
+    appendByte(report, '\n');
+
+  // Flush pending stdio output, then write the whole document in one call:
+  fflush(file);
+
+#ifdef OS_WINDOWS
+  // Text mode would expand every 0x0A byte to CR LF, corrupting CBOR:
+  const int mode = _setmode(_fileno(file), _O_BINARY);
+#endif
+
+  const char* data = report->data;
+  size_t remaining = report->length;
+  bool8_t result = BOOL8_TRUE;
+
+  while(remaining > 0) // Only loops on a partial write.
+  {
+    const long written = write(fileno(file), data, remaining);
+    if(written <= 0)
+    {
+      result = BOOL8_FALSE;
+      break;
+    }
+
+    data += written;
+    remaining -= written;
+  }
+
+#ifdef OS_WINDOWS
+  if(mode != -1)
+    _setmode(_fileno(file), mode);
+#endif
+
+  return result;
+}
+
+static void appendJsonString(Report_t* report, const char* s)
+{
+  appendByte(report, '"');
+
+  for(; *s; s++)
+  {
+    const unsigned char c = *s;
+
+    if(c == '"' || c == '\\')
+    {
+      appendByte(report, '\\');
+      appendByte(report, c);
+    }
+    else if(c < 0x20)
+    {
+      char escaped[8];
+      snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+      append(report, escaped, 6);
+    }
+    else
+      appendByte(report, c);
+  }
+
+  appendByte(report, '"');
+}
+
+static void appendCborHead(Report_t* report, uint8_t majorType, uint64_t value)
+{
+  uint8_t head[9];
+  size_t length;
+
+  if(value < 24)
+  {
+    head[0] = majorType | value;
+    length = 1;
+  }
+  else if(value <= UINT8_MAX)
+  {
+    head[0] = majorType | 24;
+    length = 2;
+  }
+  else if(value <= UINT16_MAX)
+  {
+    head[0] = majorType | 25;
+    length = 3;
+  }
+  else if(value <= UINT32_MAX)
+  {
+    head[0] = majorType | 26;
+    length = 5;
+  }
+  else
+  {
+    head[0] = majorType | 27;
+    length = 9;
+  }
+
+  // Big endian argument:
+  for(size_t i = length - 1; i > 0; i--)
+  {
+    head[i] = value & 0xff;
+    value >>= 8;
+  }
+
+  append(report, head, length);
+}
+
+static void appendCborText(Report_t* report, const char* s)
+{
+  const size_t length = strlen(s);
+  appendCborHead(report, CBOR_TEXT, length);
+  append(report, s, length);
+}
+
+// Separator and key of the next member:
+static void beginValue(Report_t* report, const char* key)
+{
+  if(report->format == REPORT_JSON)
+  {
+    if(!report->first[report->depth])
+      appendByte(report, ',');
+    report->first[report->depth] = BOOL8_FALSE;
+
+    if(key)
+    {
+      appendJsonString(report, key);
+      appendByte(report, ':');
+    }
+  }
+  else if(key)
+  {
+    appendCborText(report, key);
+  }
+}
+
+static void beginContainer(Report_t* report, const char* key, char jsonOpen, uint8_t cborMajorType)
+{
+  beginValue(report, key);
+
+  if(report->format == REPORT_JSON)
+    appendByte(report, jsonOpen);
+  else
+    appendByte(report, cborMajorType | CBOR_INDEFINITE);
+
+  if(report->depth + 1 < REPORT_DEPTH_MAX)
+    report->depth++;
+  else
+    fprintf(stderr, "Report nesting too deep" NEWLINE);
+
+  report->first[report->depth] = BOOL8_TRUE;
+}
+
+static void endContainer(Report_t* report, char jsonClose)
+{
+  if(report->depth > 0)
+    report->depth--;
+
+  if(report->format == REPORT_JSON)
+    appendByte(report, jsonClose);
+  else
+    appendByte(report, CBOR_BREAK);
+}
+
+void reportBeginObject(Report_t* report, const char* key)
+{
+  beginContainer(report, key, '{', CBOR_MAP);
+}
+
+void reportEndObject(Report_t* report)
+{
+  endContainer(report, '}');
+}
+
+void reportBeginArray(Report_t* report, const char* key)
+{
+  beginContainer(report, key, '[', CBOR_ARRAY);
+}
+
+void reportEndArray(Report_t* report)
+{
+  endContainer(report, ']');
+}
+
+void reportString(Report_t* report, const char* key, const char* value)
+{
+  beginValue(report, key);
+
+  if(report->format == REPORT_JSON)
+    appendJsonString(report, value);
+  else
+    appendCborText(report, value);
+}
+
+void reportBytes(Report_t* report, const char* key, const uint8_t* data, uint32_t length)
+{
+  beginValue(report, key);
+
+  if(report->format == REPORT_JSON)
+  {
+    // Hexadecimal string:
+    static const char digits[] = "0123456789abcdef";
+    reserve(report, 2 * (size_t)length + 2);
+    appendByte(report, '"');
+    for(uint32_t i = 0; i < length; i++)
+    {
+      report->data[report->length++] = digits[data[i] >> 4];
+      report->data[report->length++] = digits[data[i] & 0x0f];
+    }
+    appendByte(report, '"');
+  }
+  else
+  {
+    appendCborHead(report, CBOR_BYTES, length);
+    append(report, data, length);
+  }
+}
+
+void reportUInt(Report_t* report, const char* key, uint64_t value)
+{
+  beginValue(report, key);
+
+  if(report->format == REPORT_JSON)
+  {
+    char s[24];
+    append(report, s, snprintf(s, sizeof(s), "%" PRIu64, value));
+  }
+  else
+    appendCborHead(report, CBOR_UINT, value);
+}
+
+void reportInt(Report_t* report, const char* key, int64_t value)
+{
+  if(value >= 0)
+  {
+    reportUInt(report, key, value);
+    return;
+  }
+
+  beginValue(report, key);
+
+  if(report->format == REPORT_JSON)
+  {
+    char s[24];
+    append(report, s, snprintf(s, sizeof(s), "%" PRIi64, value));
+  }
+  else
+    appendCborHead(report, CBOR_NEGINT, (uint64_t)(-(value + 1)));
+}
+
+void reportDouble(Report_t* report, const char* key, double value)
+{
+  beginValue(report, key);
+
+  if(report->format == REPORT_JSON)
+  {
+    if(isfinite(value))
+    {
+      char s[32];
+      append(report, s, snprintf(s, sizeof(s), "%.17g", value));
+    }
+    else
+      append(report, "null", 4);
+  }
+  else
+  {
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+
+    uint8_t encoded[9];
+    encoded[0] = CBOR_DOUBLE;
+    for(int i = 8; i > 0; i--)
+    {
+      encoded[i] = bits & 0xff;
+      bits >>= 8;
+    }
+    append(report, encoded, sizeof(encoded));
+  }
+}
+
+void reportBool(Report_t* report, const char* key, bool8_t value)
+{
+  beginValue(report, key);
+
+  if(report->format == REPORT_JSON)
+  {
+    if(value)
+      append(report, "true", 4);
+    else
+      append(report, "false", 5);
+  }
+  else
+    appendByte(report, value ? CBOR_TRUE : CBOR_FALSE);
+}
+
+void reportDoubles(Report_t* report, const char* key, const double* values, uint32_t count)
+{
+  reportBeginArray(report, key);
+  for(uint32_t i = 0; i < count; i++)
+    reportDouble(report, NULL, values[i]);
+  reportEndArray(report);
+}
+
+void reportFlags(Report_t* report, const char* key, uint64_t value, const char** names, unsigned int count)
+{
+  reportBeginArray(report, key);
+  for(unsigned int i = 0; i < count; i++)
+  {
+    if(value & (1ULL << i))
+      reportString(report, NULL, names[i]);
+  }
+  reportEndArray(report);
+}
+
+// Single value of a bit set, null if unknown:
+static void reportFlag(Report_t* report, const char* key, uint64_t value, const char** names, unsigned int count)
+{
+  for(unsigned int i = 0; i < count; i++)
+  {
+    if(value == (1ULL << i))
+    {
+      reportString(report, key, names[i]);
+      return;
+    }
+  }
+
+  beginValue(report, key);
+  if(report->format == REPORT_JSON)
+    append(report, "null", 4);
+  else
+    appendByte(report, CBOR_NULL);
+}
+
+static void reportVersion(Report_t* report, const char* key, TpVersion_t version)
+{
+  char s[32];
+  snprintf(s, sizeof(s), "%" PRIu16 ".%" PRIu16 ".%" PRIu16 ".%" PRIu16, (uint16_t)TPVERSION_MAJOR(version), (uint16_t)TPVERSION_MINOR(version), (uint16_t)TPVERSION_RELEASE(version), (uint16_t)TPVERSION_BUILD(version));
+  reportString(report, key, s);
+}
+
+static void reportIPv4Address(Report_t* report, const char* key, uint32_t ipv4Address)
+{
+  char s[16];
+  snprintf(s, sizeof(s), "%" PRIu32 ".%" PRIu32 ".%" PRIu32 ".%" PRIu32, ipv4Address >> 24, (ipv4Address >> 16) & 0xff, (ipv4Address >> 8) & 0xff, ipv4Address & 0xff);
+  reportString(report, key, s);
+}
+
+void reportLibraryInfo(Report_t* report, const char* key, const LibraryInfo_t* info)
+{
+  reportBeginObject(report, key);
+  reportVersion(report, "version", info->version);
+  reportString(report, "versionExtra", info->versionExtra);
+  reportBytes(report, "configuration", info->config, info->configLength);
+  reportEndObject(report);
+}
+
+static void reportTriggerInputs(Report_t* report, const DeviceInfo_t* info)
+{
+  reportBeginArray(report, "triggerInputs");
+  for(uint16_t i = 0; i < info->triggerInputCount; i++)
+  {
+    const TriggerInputInfo_t* input = &info->triggerInputs[i];
+
+    reportBeginObject(report, NULL);
+    reportUInt(report, "id", input->id);
+    reportString(report, "name", input->name);
+    reportBool(report, "available", input->isAvailable);
+    if(input->isAvailable)
+    {
+      reportBool(report, "enabled", input->isEnabled);
+      reportFlags(report, "kinds", input->kinds, TriggerKinds, TKN_COUNT);
+      if(input->kinds != TKM_NONE)
+        reportFlag(report, "kind", input->kind, TriggerKinds, TKN_COUNT);
+    }
+    reportEndObject(report);
+  }
+  reportEndArray(report);
+}
+
+static void reportTriggerOutputs(Report_t* report, const DeviceInfo_t* info)
+{
+  reportBeginArray(report, "triggerOutputs");
+  for(uint16_t i = 0; i < info->triggerOutputCount; i++)
+  {
+    const TriggerOutputInfo_t* output = &info->triggerOutputs[i];
+
+    reportBeginObject(report, NULL);
+    reportUInt(report, "id", output->id);
+    reportString(report, "name", output->name);
+    reportBool(report, "enabled", output->isEnabled);
+    reportFlags(report, "events", output->events, TriggerOutputEvents, TOEN_COUNT);
+    reportFlag(report, "event", output->event, TriggerOutputEvents, TOEN_COUNT);
+    reportEndObject(report);
+  }
+  reportEndArray(report);
+}
+
+static void reportChannel(Report_t* report, const ChannelInfo_t* channel)
+{
+  reportBeginObject(report, NULL);
+  reportFlag(report, "connectorType", channel->connectorType, ConnectorTypes, CONNECTORTYPE_COUNT);
+  reportBool(report, "differential", channel->isDifferential);
+  reportDouble(report, "impedance", channel->impedance);
+  reportBool(report, "connectionTest", channel->hasConnectionTest);
+  reportBool(report, "available", channel->isAvailable);
+  reportBool(report, "enabled", channel->isEnabled);
+  reportDoubles(report, "bandwidths", channel->bandwidths, channel->bandwidthCount);
+  reportDouble(report, "bandwidth", channel->bandwidth);
+  reportFlags(report, "couplings", channel->couplings, Couplings, CKN_COUNT);
+  reportFlag(report, "coupling", channel->coupling, Couplings, CKN_COUNT);
+  reportBool(report, "autoRanging", channel->autoRanging);
+  reportDoubles(report, "ranges", channel->ranges, channel->rangeCount);
+  reportDouble(report, "range", channel->range);
+  reportDouble(report, "probeGain", channel->probeGain);
+  reportDouble(report, "probeOffset", channel->probeOffset);
+
+  if(channel->hasSafeGround)
+  {
+    reportBeginObject(report, "safeGround");
+    reportBool(report, "enabled", channel->safeGroundEnabled);
+    reportDouble(report, "thresholdMin", channel->safeGroundThresholdMin);
+    reportDouble(report, "thresholdMax", channel->safeGroundThresholdMax);
+    reportDouble(report, "threshold", channel->safeGroundThreshold);
+    reportEndObject(report);
+  }
+
+  if(channel->hasTrigger)
+  {
+    const ChannelTriggerInfo_t* trigger = &channel->trigger;
+
+    reportBeginObject(report, "trigger");
+    reportBool(report, "available", trigger->isAvailable);
+    reportBool(report, "enabled", trigger->isEnabled);
+    reportFlags(report, "kinds", trigger->kinds, TriggerKinds, TKN_COUNT);
+    reportFlag(report, "kind", trigger->kind, TriggerKinds, TKN_COUNT);
+    reportFlags(report, "levelModes", trigger->levelModes, TriggerLevelModes, TLMN_COUNT);
+    reportFlag(report, "levelMode", trigger->levelMode, TriggerLevelModes, TLMN_COUNT);
+    reportDoubles(report, "levels", trigger->levels, trigger->levelCount);
+    reportDoubles(report, "hystereses", trigger->hystereses, trigger->hysteresisCount);
+    reportFlags(report, "conditions", trigger->conditions, TriggerConditions, TCN_COUNT);
+    if(trigger->conditions != TCM_NONE)
+      reportFlag(report, "condition", trigger->condition, TriggerConditions, TCN_COUNT);
+    reportDoubles(report, "times", trigger->times, trigger->timeCount);
+    reportEndObject(report);
+  }
+
+  reportEndObject(report);
+}
+
+static void reportOscilloscope(Report_t* report, const OscilloscopeInfo_t* scp)
+{
+  reportBeginObject(report, "oscilloscope");
+  reportUInt(report, "channelCount", scp->channelCount);
+  reportBool(report, "connectionTest", scp->hasConnectionTest);
+  reportFlags(report, "measureModes", scp->measureModes, MeasureModes, MMN_COUNT);
+  reportFlag(report, "measureMode", scp->measureMode, MeasureModes, MMN_COUNT);
+  reportFlags(report, "autoResolutionModes", scp->autoResolutionModes, AutoResolutionModes, ARN_COUNT);
+  reportFlag(report, "autoResolutionMode", scp->autoResolutionMode, AutoResolutionModes, ARN_COUNT);
+
+  reportBeginArray(report, "resolutions");
+  for(uint32_t i = 0; i < scp->resolutionCount; i++)
+    reportUInt(report, NULL, scp->resolutions[i]);
+  reportEndArray(report);
+
+  reportUInt(report, "resolution", scp->resolution);
+  reportBool(report, "resolutionEnhanced", scp->isResolutionEnhanced);
+  reportFlags(report, "clockOutputs", scp->clockOutputs, ClockOutputTypes, CON_COUNT);
+  reportFlag(report, "clockOutput", scp->clockOutput, ClockOutputTypes, CON_COUNT);
+  if(scp->clockOutputFrequencyCount > 0)
+  {
+    reportDoubles(report, "clockOutputFrequencies", scp->clockOutputFrequencies, scp->clockOutputFrequencyCount);
+    reportDouble(report, "clockOutputFrequency", scp->clockOutputFrequency);
+  }
+  reportFlags(report, "clockSources", scp->clockSources, ClockSources, CSN_COUNT);
+  reportFlag(report, "clockSource", scp->clockSource, ClockSources, CSN_COUNT);
+  if(scp->clockSourceFrequencyCount > 0)
+  {
+    reportDoubles(report, "clockSourceFrequencies", scp->clockSourceFrequencies, scp->clockSourceFrequencyCount);
+    reportDouble(report, "clockSourceFrequency", scp->clockSourceFrequency);
+  }
+  reportUInt(report, "recordLengthMax", scp->recordLengthMax);
+  reportUInt(report, "recordLength", scp->recordLength);
+  reportDouble(report, "sampleFrequencyMax", scp->sampleFrequencyMax);
+  reportDouble(report, "sampleFrequency", scp->sampleFrequency);
+
+  if(scp->measureMode == MM_BLOCK)
+  {
+    reportUInt(report, "segmentCountMax", scp->segmentCountMax);
+    reportUInt(report, "segmentCount", scp->segmentCount);
+  }
+
+  if(scp->hasTrigger)
+  {
+    reportDouble(report, "preSampleRatio", scp->preSampleRatio);
+    reportDouble(report, "triggerTimeOut", scp->triggerTimeOut); // TO_INFINITY for infinite.
+    if(scp->hasTriggerDelay)
+    {
+      reportDouble(report, "triggerDelayMax", scp->triggerDelayMax);
+      reportDouble(report, "triggerDelay", scp->triggerDelay);
+    }
+    if(scp->hasTriggerHoldOff)
+    {
+      reportUInt(report, "triggerHoldOffCountMax", scp->triggerHoldOffCountMax);
+      reportUInt(report, "triggerHoldOffCount", scp->triggerHoldOffCount);
+    }
+  }
+
+  reportBeginArray(report, "channels");
+  for(uint16_t ch = 0; ch < scp->channelCount; ch++)
+    reportChannel(report, &scp->channels[ch]);
+  reportEndArray(report);
+
+  reportEndObject(report);
+}
+
+static void reportRange(Report_t* report, const char* key, double min, double max, double value)
+{
+  reportBeginObject(report, key);
+  reportDouble(report, "min", min);
+  reportDouble(report, "max", max);
+  reportDouble(report, "value", value);
+  reportEndObject(report);
+}
+
+static void reportGenerator(Report_t* report, const GeneratorInfo_t* gen)
+{
+  reportBeginObject(report, "generator");
+  reportFlag(report, "connectorType", gen->connectorType, ConnectorTypes, CONNECTORTYPE_COUNT);
+  reportBool(report, "differential", gen->isDifferential);
+  reportBool(report, "controllable", gen->isControllable);
+  reportDouble(report, "impedance", gen->impedance);
+  reportUInt(report, "resolution", gen->resolution);
+  reportDouble(report, "outputValueMin", gen->outputValueMin);
+  reportDouble(report, "outputValueMax", gen->outputValueMax);
+  reportBool(report, "outputOn", gen->outputOn);
+  if(gen->hasOutputInvert)
+    reportBool(report, "outputInvert", gen->outputInvert);
+
+  reportFlags(report, "modesNative", gen->modesNative, GeneratorModes, GMN_COUNT);
+  reportFlags(report, "modes", gen->modes, GeneratorModes, GMN_COUNT);
+  if(gen->modes != GMM_NONE)
+  {
+    reportFlag(report, "mode", gen->mode, GeneratorModes, GMN_COUNT);
+    if(gen->mode & GMM_BURST_COUNT)
+    {
+      reportBool(report, "burstActive", gen->isBurstActive);
+      reportUInt(report, "burstCountMax", gen->burstCountMax);
+      reportUInt(report, "burstCount", gen->burstCount);
+    }
+    if(gen->mode & GMM_BURST_SAMPLE_COUNT)
+    {
+      reportUInt(report, "burstSampleCountMax", gen->burstSampleCountMax);
+      reportUInt(report, "burstSampleCount", gen->burstSampleCount);
+    }
+    if(gen->mode & GMM_BURST_SEGMENT_COUNT)
+    {
+      reportUInt(report, "burstSegmentCountMax", gen->burstSegmentCountMax);
+      reportUInt(report, "burstSegmentCount", gen->burstSegmentCount);
+    }
+  }
+
+  reportFlags(report, "signalTypes", gen->signalTypes, SignalTypes, STN_COUNT);
+  reportFlag(report, "signalType", gen->signalType, SignalTypes, STN_COUNT);
+
+  if(gen->hasAmplitude)
+  {
+    reportRange(report, "amplitude", gen->amplitudeMin, gen->amplitudeMax, gen->amplitude);
+    reportDoubles(report, "amplitudeRanges", gen->amplitudeRanges, gen->amplitudeRangeCount);
+    reportDouble(report, "amplitudeRange", gen->amplitudeRange);
+    reportBool(report, "amplitudeAutoRanging", gen->amplitudeAutoRanging);
+  }
+
+  if(gen->hasFrequency)
+  {
+    reportFlags(report, "frequencyModes", gen->frequencyModes, FrequencyModes, FMN_COUNT);
+    reportFlag(report, "frequencyMode", gen->frequencyMode, FrequencyModes, FMN_COUNT);
+    reportRange(report, "frequency", gen->frequencyMin, gen->frequencyMax, gen->frequency);
+  }
+
+  if(gen->hasOffset)
+    reportRange(report, "offset", gen->offsetMin, gen->offsetMax, gen->offset);
+
+  if(gen->hasPhase)
+    reportRange(report, "phase", gen->phaseMin, gen->phaseMax, gen->phase);
+
+  if(gen->hasSymmetry)
+    reportRange(report, "symmetry", gen->symmetryMin, gen->symmetryMax, gen->symmetry);
+
+  if(gen->hasWidth)
+    reportRange(report, "width", gen->widthMin, gen->widthMax, gen->width);
+
+  if(gen->hasEdgeTime)
+  {
+    reportRange(report, "leadingEdgeTime", gen->leadingEdgeTimeMin, gen->leadingEdgeTimeMax, gen->leadingEdgeTime);
+    reportRange(report, "trailingEdgeTime", gen->trailingEdgeTimeMin, gen->trailingEdgeTimeMax, gen->trailingEdgeTime);
+  }
+
+  if(gen->hasData)
+  {
+    reportBeginObject(report, "dataLength");
+    reportUInt(report, "min", gen->dataLengthMin);
+    reportUInt(report, "max", gen->dataLengthMax);
+    reportUInt(report, "value", gen->dataLength);
+    reportEndObject(report);
+  }
+
+  reportEndObject(report);
+}
+
+static void reportI2C(Report_t* report, const I2CInfo_t* i2c)
+{
+  reportBeginObject(report, "i2cHost");
+
+  reportBeginArray(report, "internalAddresses");
+  for(uint32_t i = 0; i < i2c->internalAddressCount; i++)
+    reportUInt(report, NULL, i2c->internalAddresses[i]);
+  reportEndArray(report);
+
+  reportDouble(report, "speedMax", i2c->speedMax);
+  reportDouble(report, "speed", i2c->speed);
+  reportEndObject(report);
+}
+
+void reportDeviceInfo(Report_t* report, const char* key, const DeviceInfo_t* info)
+{
+  reportBeginObject(report, key);
+  reportFlag(report, "type", info->type, DeviceTypes, DEVICETYPE_COUNT);
+  reportString(report, "name", info->name);
+  reportString(report, "nameShort", info->nameShort);
+  reportUInt(report, "serialNumber", info->serialNumber);
+
+  if(info->calibrationDate != 0)
+  {
+    char s[16];
+    snprintf(s, sizeof(s), "%04" PRIu16 "-%02" PRIu8 "-%02" PRIu8, (uint16_t)TPDATE_YEAR(info->calibrationDate), (uint8_t)TPDATE_MONTH(info->calibrationDate), (uint8_t)TPDATE_DAY(info->calibrationDate));
+    reportString(report, "calibrationDate", s);
+  }
+
+  reportUInt(report, "productId", info->productId);
+  reportUInt(report, "vendorId", info->vendorId);
+  if(info->hasDriverVersion)
+    reportVersion(report, "driverVersion", info->driverVersion);
+  if(info->hasFirmwareVersion)
+    reportVersion(report, "firmwareVersion", info->firmwareVersion);
+  if(info->hasIPv4Address)
+    reportIPv4Address(report, "ipv4Address", info->ipv4Address);
+  if(info->hasIPPort)
+    reportUInt(report, "ipPort", info->ipPort);
+
+  if(info->hasBattery)
+  {
+    const BatteryInfo_t* battery = &info->battery;
+
+    reportBeginObject(report, "battery");
+    if(battery->hasCharge)
+      reportInt(report, "charge", battery->charge);
+    if(battery->hasTimeToEmpty)
+      reportInt(report, "timeToEmpty", battery->timeToEmpty);
+    if(battery->hasTimeToFull)
+      reportInt(report, "timeToFull", battery->timeToFull);
+    if(battery->hasChargerConnected)
+      reportBool(report, "chargerConnected", battery->isChargerConnected);
+    if(battery->hasCharging)
+      reportBool(report, "charging", battery->isCharging);
+    if(battery->hasBroken)
+      reportBool(report, "broken", battery->isBroken);
+    reportEndObject(report);
+  }
+
+  switch(info->type)
+  {
+    case DEVICETYPE_OSCILLOSCOPE:
+      reportOscilloscope(report, &info->oscilloscope);
+      break;
+
+    case DEVICETYPE_GENERATOR:
+      reportGenerator(report, &info->generator);
+      break;
+
+    case DEVICETYPE_I2CHOST:
+      reportI2C(report, &info->i2c);
+      break;
+  }
+
+  reportTriggerInputs(report, info);
+  reportTriggerOutputs(report, info);
+
+  reportEndObject(report);
+}
+
+void reportServerInfo(Report_t* report, const char* key, const ServerInfo_t* info)
+{
+  reportBeginObject(report, key);
+  reportString(report, "url", info->url);
+  reportString(report, "name", info->name);
+  reportString(report, "description", info->description);
+  reportIPv4Address(report, "ipv4Address", info->ipv4Address);
+  reportUInt(report, "ipPort", info->ipPort);
+  reportString(report, "id", info->id);
+  reportVersion(report, "version", info->version);
+  reportString(report, "status", ServerStatuses[info->status]);
+  reportString(report, "lastError", ServerErrorCodes[info->lastError]);
+  reportEndObject(report);
+}
@@ -0,0 +1,65 @@
+/**
+ * Report.h
+ *
+ * This file is part of the LibTiePie programming examples.
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#ifndef _REPORT_H_
+#define _REPORT_H_
+
+#include <stdio.h>
+#include <stddef.h>
+#include <libtiepie.h>
+#include "DeviceInfo.h"
+
+// Machine readable reports of device info snapshots.
+// The document is built in one growable buffer and written at once with reportWrite().
+
+// Report formats:
+#define REPORT_JSON 0
+#define REPORT_CBOR 1 // Compact binary (RFC 8949).
+
+#define REPORT_DEPTH_MAX 16
+
+typedef struct
+{
+  int format;
+  char* data;
+  size_t length;
+  size_t capacity;
+  unsigned int depth;
+  bool8_t first[REPORT_DEPTH_MAX]; // JSON: no separator needed before next member.
+} Report_t;
+
+void reportInit(Report_t* report, int format);
+void reportFree(Report_t* report);
+
+// Write the document to file, returns BOOL8_TRUE on success:
+bool8_t reportWrite(Report_t* report, FILE* file);
+
+// Structure, key must be NULL for array elements and the top level value:
+void reportBeginObject(Report_t* report, const char* key);
+void reportEndObject(Report_t* report);
+void reportBeginArray(Report_t* report, const char* key);
+void reportEndArray(Report_t* report);
+
+// Values:
+void reportString(Report_t* report, const char* key, const char* value);
+void reportBytes(Report_t* report, const char* key, const uint8_t* data, uint32_t length);
+void reportUInt(Report_t* report, const char* key, uint64_t value);
+void reportInt(Report_t* report, const char* key, int64_t value);
+void reportDouble(Report_t* report, const char* key, double value);
+void reportBool(Report_t* report, const char* key, bool8_t value);
+void reportDoubles(Report_t* report, const char* key, const double* values, uint32_t count);
+
+// Bit set as array of names, using the string tables from PrintInfo:
+void reportFlags(Report_t* report, const char* key, uint64_t value, const char** names, unsigned int count);
+
+// Device info snapshots:
+void reportLibraryInfo(Report_t* report, const char* key, const LibraryInfo_t* info);
+void reportDeviceInfo(Report_t* report, const char* key, const DeviceInfo_t* info);
+void reportServerInfo(Report_t* report, const char* key, const ServerInfo_t* info);
+
+#endif
@@ -0,0 +1,209 @@
+/**
+ * Resample.c
+ *
+ * This file is part of the LibTiePie programming examples.
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#include "Resample.h"
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "Parallel.h"
+
+#define RESAMPLE_ZERO_CROSSINGS 16 // Filter half width at the lowest sample frequency.
+#define RESAMPLE_HALF_MAX 2048 // Filter half width limit in input samples, reached when reducing the length over 128 times.
+#define RESAMPLE_PHASES 256
+#define RESAMPLE_CUTOFF 0.45 // Cycles per sample at the lowest sample frequency.
+#define RESAMPLE_KAISER_BETA 9.0
+#define RESAMPLE_BLOCK 4096 // Output samples.
+#define RESAMPLE_PARALLEL_MIN 65536
+
+#ifndef M_PI
+#  define M_PI 3.14159265358979323846
+#endif
+
+typedef float v4sf __attribute__((vector_size(16)));
+
+typedef struct
+{
+  const float* input;
+  uint64_t inputLength;
+  float* output;
+  uint64_t outputLength;
+  unsigned int taps; // Multiple of 4.
+  int64_t offset; // Of the first tap, relative to the input sample before the output position.
+  float* table; // RESAMPLE_PHASES + 1 rows of taps coefficients.
+} ResampleParams_t;
+
+// Modified Bessel function of the first kind, order 0:
+static double besselI0(double x)
+{
+  double sum = 1;
+  double term = 1;
+
+  for(unsigned int k = 1; term > 1e-12 * sum; k++)
+  {
+    term *= (x / (2 * k)) * (x / (2 * k));
+    sum += term;
+  }
+
+  return sum;
+}
+
+static float* createTable(unsigned int taps, int64_t offset, double cutoff, double halfWidth)
+{
+  float* table = malloc(sizeof(float) * taps * (RESAMPLE_PHASES + 1));
+  if(!table)
+    return NULL;
+
+  const double i0Beta = besselI0(RESAMPLE_KAISER_BETA);
+
+  for(unsigned int p = 0; p <= RESAMPLE_PHASES; p++)
+  {
+    float* row = table + p * taps;
+    double sum = 0;
+
+    for(unsigned int k = 0; k < taps; k++)
+    {
+      // Distance of the input sample to the output position:
+      const double x = (double)(offset + k) - (double)p / RESAMPLE_PHASES;
+      const double u = x / halfWidth;
+      const double sinc = x == 0 ? 1 : sin(2 * M_PI * cutoff * x) / (2 * M_PI * cutoff * x);
+      const double window = fabs(u) < 1 ? besselI0(RESAMPLE_KAISER_BETA * sqrt(1 - u * u)) / i0Beta : 0;
+
+      row[k] = (float)(sinc * window);
+      sum += row[k];
+    }
+
+    // Unity gain at DC for every phase:
+    for(unsigned int k = 0; k < taps; k++)
+      row[k] = (float)(row[k] / sum);
+  }
+
+  return table;
+}
+
+// Filter a window with two adjacent phases and interpolate between them:
+static inline float filter(const float* window, const float* row0, const float* row1, float weight, unsigned int taps)
+{
+  v4sf acc0 = {0};
+  v4sf acc1 = {0};
+
+  for(unsigned int k = 0; k < taps; k += 4)
+  {
+    v4sf x, c0, c1;
+    memcpy(&x, window + k, sizeof(x));
+    memcpy(&c0, row0 + k, sizeof(c0));
+    memcpy(&c1, row1 + k, sizeof(c1));
+    acc0 += x * c0;
+    acc1 += x * c1;
+  }
+
+  const v4sf acc = acc0 + weight * (acc1 - acc0);
+  return (acc[0] + acc[1]) + (acc[2] + acc[3]);
+}
+
+static void resampleBlock(uint64_t start, uint64_t end, void* arg)
+{
+  const ResampleParams_t* params = arg;
+  const uint64_t inputLength = params->inputLength;
+  const uint64_t outputLength = params->outputLength;
+  const uint64_t step = inputLength / outputLength;
+  const uint64_t stepRemainder = inputLength % outputLength;
+  const unsigned int taps = params->taps;
+  float wrapped[2 * RESAMPLE_HALF_MAX];
+
+  // Input position of output sample j is j * inputLength / outputLength, kept as integer and remainder:
+  uint64_t base = start * inputLength / outputLength;
+  uint64_t remainder = start * inputLength % outputLength;
+
+  for(uint64_t j = start; j < end; j++)
+  {
+    const double phase = (double)remainder / outputLength * RESAMPLE_PHASES;
+    const unsigned int p = (unsigned int)phase;
+    const int64_t first = (int64_t)base + params->offset;
+    const float* window;
+
+    if(first >= 0 && (uint64_t)first + taps <= inputLength)
+      window = params->input + first;
+    else
+    {
+      // Periodic wrap around at the start and end:
+      for(unsigned int k = 0; k < taps; k++)
+      {
+        int64_t i = (first + k) % (int64_t)inputLength;
+        if(i < 0)
+          i += inputLength;
+        wrapped[k] = params->input[i];
+      }
+      window = wrapped;
+    }
+
+    params->output[j] = filter(window, params->table + p * taps, params->table + (p + 1) * taps, (float)(phase - p), taps);
+
+    base += step;
+    remainder += stepRemainder;
+    if(remainder >= outputLength)
+    {
+      remainder -= outputLength;
+      base++;
+    }
+  }
+}
+
+uint64_t getResampleLength(LibTiePieHandle_t gen, uint64_t inputLength, double inputSampleFrequency, double outputSampleFrequency)
+{
+  uint64_t length = inputLength;
+
+  if(inputSampleFrequency > 0 && outputSampleFrequency > 0)
+    length = (uint64_t)llround(inputLength * (outputSampleFrequency / inputSampleFrequency));
+
+  const uint64_t lengthMin = GenGetDataLengthMin(gen);
+  const uint64_t lengthMax = GenGetDataLengthMax(gen);
+
+  if(length < lengthMin)
+    length = lengthMin;
+  else if(length > lengthMax)
+    length = lengthMax;
+
+  return length;
+}
+
+bool8_t resample(const float* input, uint64_t inputLength, float* output, uint64_t outputLength)
+{
+  ResampleParams_t params;
+
+  if(inputLength == 0 || outputLength == 0)
+    return BOOL8_TRUE;
+
+  if(inputLength == outputLength)
+  {
+    memcpy(output, input, sizeof(float) * outputLength);
+    return BOOL8_TRUE;
+  }
+
+  // Lower the cutoff when reducing the length, the filter gets wider by the same factor:
+  const double scale = outputLength < inputLength ? (double)outputLength / inputLength : 1;
+  unsigned int half = (unsigned int)ceil(RESAMPLE_ZERO_CROSSINGS / scale);
+  if(half > RESAMPLE_HALF_MAX)
+    half = RESAMPLE_HALF_MAX;
+  half = (half + 1) & ~1U; // Taps multiple of 4.
+
+  params.input = input;
+  params.inputLength = inputLength;
+  params.output = output;
+  params.outputLength = outputLength;
+  params.taps = 2 * half;
+  params.offset = 1 - (int64_t)half;
+  params.table = createTable(params.taps, params.offset, RESAMPLE_CUTOFF * scale, half);
+  if(!params.table)
+    return BOOL8_FALSE;
+
+  parallelFor(outputLength, RESAMPLE_BLOCK, RESAMPLE_PARALLEL_MIN, resampleBlock, &params);
+
+  free(params.table);
+
+  return BOOL8_TRUE;
+}
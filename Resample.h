@@ -0,0 +1,26 @@
+/**
+ * Resample.h
+ *
+ * This file is part of the LibTiePie programming examples.
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#ifndef _RESAMPLE_H_
+#define _RESAMPLE_H_
+
+#include <libtiepie.h>
+
+// Resampling of arbitrary waveforms to a length the generator supports.
+// A Kaiser windowed sinc polyphase filter is used, with linear interpolation between the filter phases.
+// When the length is reduced, the cutoff frequency is lowered to avoid aliasing.
+// The waveform is treated as periodic, like the generator plays it, and output blocks are filtered on all processors.
+
+// Output length for a generator: the input length scaled by the sample frequency ratio,
+// limited to GenGetDataLengthMin()..GenGetDataLengthMax(). Pass 0 for the sample frequencies to only limit the length.
+uint64_t getResampleLength(LibTiePieHandle_t gen, uint64_t inputLength, double inputSampleFrequency, double outputSampleFrequency);
+
+// Resample input to outputLength samples, returns BOOL8_FALSE if out of memory:
+bool8_t resample(const float* input, uint64_t inputLength, float* output, uint64_t outputLength);
+
+#endif
@@ -0,0 +1,111 @@
+/**
+ * ResampleBenchmark.c
+ *
+ * This example measures the throughput of the arbitrary waveform resampler, no device is needed.
+ * A multitone waveform is resampled with several ratios and compared with the exact waveform at the new sample frequency.
+ * Usage: ResampleBenchmark [input length in MSa, default 64]
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <inttypes.h>
+#include <math.h>
+#include <libtiepie.h>
+#include "Resample.h"
+#include "Utils.h"
+#include "WaveformSynth.h"
+
+#define SAMPLE_FREQUENCY 100e6 // 100 MHz
+#define CHECK_LENGTH 1000000 // Samples compared with the exact waveform.
+
+static const SynthTone_t tones[] = {
+  {1e6, 0.5, 0},
+  {3.7e6, 0.3, 0.25},
+  {8.1e6, 0.2, 0.5}
+};
+#define TONE_COUNT (sizeof(tones) / sizeof(tones[0]))
+
+static const double ratios[] = {0.75, 0.5, 0.25, 1.5};
+#define RATIO_COUNT (sizeof(ratios) / sizeof(ratios[0]))
+
+int main(int argc, char* argv[])
+{
+  int status = EXIT_SUCCESS;
+  const uint64_t inputLength = (argc > 1 ? strtoull(argv[1], NULL, 10) : 64) * 1000000;
+
+  if(inputLength < 2 * CHECK_LENGTH)
+  {
+    fprintf(stderr, "Usage: %s [input length in MSa, at least 2]" NEWLINE, argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  printf("Processors: %u" NEWLINE, getProcessorCount());
+
+  // Create input waveform:
+  float* input = malloc(sizeof(float) * inputLength);
+  if(!input)
+  {
+    fprintf(stderr, "Out of memory!" NEWLINE);
+    return EXIT_FAILURE;
+  }
+  synthMultitone(input, inputLength, SAMPLE_FREQUENCY, tones, TONE_COUNT);
+
+  float* reference = malloc(sizeof(float) * CHECK_LENGTH);
+
+  for(unsigned int i = 0; i < RATIO_COUNT && status == EXIT_SUCCESS; i++)
+  {
+    const uint64_t outputLength = (uint64_t)llround(inputLength * ratios[i]);
+    float* output = malloc(sizeof(float) * outputLength);
+
+    if(output && reference)
+    {
+      const uint64_t start = getTimeNanoSeconds();
+      if(resample(input, inputLength, output, outputLength))
+      {
+        const double seconds = (getTimeNanoSeconds() - start) / 1e9;
+
+        // Exact waveform at the new sample frequency, from the middle of the output:
+        const double sampleFrequency = SAMPLE_FREQUENCY * outputLength / inputLength;
+        const uint64_t offset = (outputLength - CHECK_LENGTH) / 2;
+        SynthTone_t shifted[TONE_COUNT];
+        for(unsigned int t = 0; t < TONE_COUNT; t++)
+        {
+          shifted[t] = tones[t];
+          shifted[t].phase = fmod(tones[t].phase + tones[t].frequency * offset / sampleFrequency, 1);
+        }
+        synthMultitone(reference, CHECK_LENGTH, sampleFrequency, shifted, TONE_COUNT);
+
+        double signal = 0;
+        double noise = 0;
+        for(uint64_t j = 0; j < CHECK_LENGTH; j++)
+        {
+          const double error = output[offset + j] - reference[j];
+          signal += (double)reference[j] * reference[j];
+          noise += error * error;
+        }
+
+        printf("%" PRIu64 " -> %" PRIu64 " samples: %.3f s, %.1f MSa/s in, %.1f MSa/s out, SNR %.1f dB" NEWLINE,
+               inputLength, outputLength, seconds, inputLength / seconds / 1e6, outputLength / seconds / 1e6, 10 * log10(signal / noise));
+      }
+      else
+      {
+        fprintf(stderr, "Resample failed!" NEWLINE);
+        status = EXIT_FAILURE;
+      }
+    }
+    else
+    {
+      fprintf(stderr, "Out of memory!" NEWLINE);
+      status = EXIT_FAILURE;
+    }
+
+    free(output);
+  }
+
+  free(reference);
+  free(input);
+
+  return status;
+}
@@ -0,0 +1,162 @@
+/**
+ * SampleBuffer.c
+ *
+ * This file is part of the LibTiePie programming examples.
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#include "SampleBuffer.h"
+#include <stdlib.h>
+#include "Utils.h"
+#ifdef OS_WINDOWS
+#  include <windows.h>
+#else // POSIX
+#  include <stdint.h>
+#  include <sys/mman.h>
+#endif
+
+#define ROUND_UP(value, multiple) (((value) + (multiple) - 1) / (multiple) * (multiple))
+
+#ifdef OS_WINDOWS
+
+static void* allocPages(size_t* size, bool8_t hugePages, int* pages)
+{
+  if(hugePages)
+  {
+    const SIZE_T largePageSize = GetLargePageMinimum();
+    if(largePageSize > 0)
+    {
+      const size_t largeSize = ROUND_UP(*size, largePageSize);
+      void* memory = VirtualAlloc(NULL, largeSize, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+      if(memory)
+      {
+        *size = largeSize;
+        *pages = SAMPLEBUFFER_PAGES_HUGE;
+        return memory;
+      }
+    }
+  }
+
+  *pages = SAMPLEBUFFER_PAGES_NORMAL;
+  return VirtualAlloc(NULL, *size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+}
+
+static void freePages(void* memory, size_t size)
+{
+  (void)size;
+  VirtualFree(memory, 0, MEM_RELEASE);
+}
+
+#else // POSIX
+
+static void* allocPages(size_t* size, bool8_t hugePages, int* pages)
+{
+  void* memory;
+
+  if(hugePages)
+  {
+    const size_t hugeSize = ROUND_UP(*size, SAMPLEBUFFER_HUGE_PAGE_SIZE);
+
+#ifdef MAP_HUGETLB
+    // Explicit huge pages, only if reserved in /proc/sys/vm/nr_hugepages:
+    memory = mmap(NULL, hugeSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if(memory != MAP_FAILED)
+    {
+      *size = hugeSize;
+      *pages = SAMPLEBUFFER_PAGES_HUGE;
+      return memory;
+    }
+#endif
+
+#ifdef MADV_HUGEPAGE
+    // Transparent huge pages need a huge page aligned range, map extra and trim:
+    uint8_t* mapping = mmap(NULL, hugeSize + SAMPLEBUFFER_HUGE_PAGE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(mapping != MAP_FAILED)
+    {
+      uint8_t* aligned = (uint8_t*)ROUND_UP((uintptr_t)mapping, SAMPLEBUFFER_HUGE_PAGE_SIZE);
+
+      if(aligned > mapping)
+        munmap(mapping, aligned - mapping);
+      munmap(aligned + hugeSize, mapping + SAMPLEBUFFER_HUGE_PAGE_SIZE - aligned);
+
+      *size = hugeSize;
+      *pages = madvise(aligned, hugeSize, MADV_HUGEPAGE) == 0 ? SAMPLEBUFFER_PAGES_TRANSPARENT_HUGE : SAMPLEBUFFER_PAGES_NORMAL;
+      return aligned;
+    }
+#endif
+  }
+
+  memory = mmap(NULL, *size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if(memory == MAP_FAILED)
+    return NULL;
+
+#ifdef MADV_NOHUGEPAGE
+  // Normal pages requested, also when transparent huge pages are enabled system wide:
+  if(!hugePages)
+    madvise(memory, *size, MADV_NOHUGEPAGE);
+#endif
+
+  *pages = SAMPLEBUFFER_PAGES_NORMAL;
+  return memory;
+}
+
+static void freePages(void* memory, size_t size)
+{
+  munmap(memory, size);
+}
+
+#endif
+
+bool8_t sampleBufferAlloc(SampleBuffer_t* buffer, uint16_t channelCount, uint64_t length, bool8_t hugePages)
+{
+  const size_t stride = ROUND_UP(sizeof(float) * length, SAMPLEBUFFER_ALIGNMENT);
+
+  buffer->channelCount = channelCount;
+  buffer->length = length;
+  buffer->size = stride * (channelCount > 0 ? channelCount : 1);
+  buffer->memory = allocPages(&buffer->size, hugePages, &buffer->pages);
+  buffer->channelData = malloc(sizeof(float*) * (channelCount > 0 ? channelCount : 1));
+
+  if(!buffer->memory || !buffer->channelData)
+  {
+    if(buffer->memory)
+      freePages(buffer->memory, buffer->size);
+    free(buffer->channelData);
+    buffer->memory = NULL;
+    buffer->channelData = NULL;
+    return BOOL8_FALSE;
+  }
+
+  for(uint16_t ch = 0; ch < channelCount; ch++)
+    buffer->channelData[ch] = (float*)((uint8_t*)buffer->memory + ch * stride);
+
+  return BOOL8_TRUE;
+}
+
+void sampleBufferFree(SampleBuffer_t* buffer)
+{
+  if(buffer->memory)
+    freePages(buffer->memory, buffer->size);
+  free(buffer->channelData);
+  buffer->memory = NULL;
+  buffer->channelData = NULL;
+}
+
+const char* sampleBufferPagesStr(int pages)
+{
+  switch(pages)
+  {
+    case SAMPLEBUFFER_PAGES_NORMAL:
+      return "normal";
+
+    case SAMPLEBUFFER_PAGES_TRANSPARENT_HUGE:
+      return "transparent huge";
+
+    case SAMPLEBUFFER_PAGES_HUGE:
+      return "huge";
+
+    default:
+      return "unknown";
+  }
+}
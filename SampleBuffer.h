@@ -0,0 +1,45 @@
+/**
+ * SampleBuffer.h
+ *
+ * This file is part of the LibTiePie programming examples.
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#ifndef _SAMPLEBUFFER_H_
+#define _SAMPLEBUFFER_H_
+
+#include <stddef.h>
+#include <libtiepie.h>
+
+// Sample buffers for very long records, all channels in one allocation.
+// Backed by 2 MB huge pages when available, which reduces TLB misses when processing the data.
+// Linux: explicit huge pages (MAP_HUGETLB) if reserved, else transparent huge pages, else normal pages.
+// Windows: large pages if the user has the "Lock pages in memory" privilege, else normal pages.
+// Each channel starts on a SAMPLEBUFFER_ALIGNMENT byte boundary.
+
+#define SAMPLEBUFFER_ALIGNMENT 64
+#define SAMPLEBUFFER_HUGE_PAGE_SIZE (2 * 1024 * 1024)
+
+// Page kinds:
+#define SAMPLEBUFFER_PAGES_NORMAL 0
+#define SAMPLEBUFFER_PAGES_TRANSPARENT_HUGE 1
+#define SAMPLEBUFFER_PAGES_HUGE 2
+
+typedef struct
+{
+  float** channelData; // For ScpGetData().
+  uint16_t channelCount;
+  uint64_t length; // Samples per channel.
+  void* memory;
+  size_t size;
+  int pages;
+} SampleBuffer_t;
+
+// Allocate channelCount channels of length samples, with normal pages only if hugePages is BOOL8_FALSE. Returns BOOL8_FALSE if out of memory:
+bool8_t sampleBufferAlloc(SampleBuffer_t* buffer, uint16_t channelCount, uint64_t length, bool8_t hugePages);
+void sampleBufferFree(SampleBuffer_t* buffer);
+
+const char* sampleBufferPagesStr(int pages);
+
+#endif
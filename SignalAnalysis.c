@@ -0,0 +1,230 @@
+/**
+ * SignalAnalysis.c
+ *
+ * This file is part of the LibTiePie programming examples.
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#include "SignalAnalysis.h"
+#include <string.h>
+#include <math.h>
+
+#define DFT_BLOCK 1024 // Samples per phasor resynchronization.
+
+#ifndef M_PI
+#  define M_PI 3.14159265358979323846
+#endif
+
+typedef float v4sf __attribute__((vector_size(16)));
+typedef int32_t v4si __attribute__((vector_size(16)));
+
+Complex_t dftBin(const float* data, uint64_t length, double frequency)
+{
+  const uint64_t vectorLength = length & ~(uint64_t)3;
+  const double step = 2 * M_PI * frequency;
+  const float c4 = (float)cos(4 * step);
+  const float s4 = (float)sin(4 * step);
+  Complex_t result = {0, 0};
+  uint64_t i;
+
+  for(uint64_t start = 0; start < vectorLength; start += DFT_BLOCK)
+  {
+    const uint64_t end = start + DFT_BLOCK < vectorLength ? start + DFT_BLOCK : vectorLength;
+    v4sf c, s;
+    v4sf accRe = {0};
+    v4sf accIm = {0};
+
+    // Exact phasor of each lane at the block start, reduced to one period first:
+    for(unsigned int lane = 0; lane < 4; lane++)
+    {
+      const double angle = 2 * M_PI * fmod(frequency * (start + lane), 1);
+      c[lane] = (float)cos(angle);
+      s[lane] = (float)sin(angle);
+    }
+
+    for(i = start; i < end; i += 4)
+    {
+      v4sf x;
+      memcpy(&x, data + i, sizeof(x));
+      accRe += x * c;
+      accIm -= x * s;
+
+      // Rotate all lanes four samples further:
+      const v4sf next = c * c4 - s * s4;
+      s = s * c4 + c * s4;
+      c = next;
+    }
+
+    result.re += (accRe[0] + accRe[1]) + (accRe[2] + accRe[3]);
+    result.im += (accIm[0] + accIm[1]) + (accIm[2] + accIm[3]);
+  }
+
+  for(i = vectorLength; i < length; i++)
+  {
+    const double angle = 2 * M_PI * fmod(frequency * i, 1);
+    result.re += data[i] * cos(angle);
+    result.im -= data[i] * sin(angle);
+  }
+
+  return result;
+}
+
+Complex_t dftBinHann(const float* data, uint64_t length, double frequency)
+{
+  // The Hann window 0.5 - 0.5 cos(2 pi n / length) in the frequency domain, a combination of three bins:
+  const double offset = 1.0 / length;
+  const Complex_t center = dftBin(data, length, frequency);
+  const Complex_t lower = dftBin(data, length, frequency - offset);
+  const Complex_t upper = dftBin(data, length, frequency + offset);
+  Complex_t result;
+
+  result.re = 0.5 * center.re - 0.25 * (lower.re + upper.re);
+  result.im = 0.5 * center.im - 0.25 * (lower.im + upper.im);
+
+  return result;
+}
+
+void getGainPhase(Complex_t signal, Complex_t reference, double* gain, double* phase)
+{
+  // signal / reference:
+  const double re = signal.re * reference.re + signal.im * reference.im;
+  const double im = signal.im * reference.re - signal.re * reference.im;
+
+  *gain = 10 * log10((signal.re * signal.re + signal.im * signal.im) / (reference.re * reference.re + reference.im * reference.im));
+  *phase = atan2(im, re) * 180 / M_PI;
+}
+
+void getMinMax(const float* data, uint64_t length, float* min, float* max)
+{
+  const uint64_t vectorLength = length & ~(uint64_t)3;
+  uint64_t i;
+
+  if(length == 0)
+  {
+    *min = 0;
+    *max = 0;
+    return;
+  }
+
+  if(vectorLength > 0)
+  {
+    v4sf vmin, vmax;
+    memcpy(&vmin, data, sizeof(vmin));
+    vmax = vmin;
+
+    for(i = 4; i < vectorLength; i += 4)
+    {
+      v4sf x;
+      memcpy(&x, data + i, sizeof(x));
+      const v4si less = x < vmin;
+      const v4si greater = x > vmax;
+      vmin = (v4sf)(((v4si)x & less) | ((v4si)vmin & ~less));
+      vmax = (v4sf)(((v4si)x & greater) | ((v4si)vmax & ~greater));
+    }
+
+    *min = fminf(fminf(vmin[0], vmin[1]), fminf(vmin[2], vmin[3]));
+    *max = fmaxf(fmaxf(vmax[0], vmax[1]), fmaxf(vmax[2], vmax[3]));
+  }
+  else
+  {
+    *min = data[0];
+    *max = data[0];
+  }
+
+  for(i = vectorLength; i < length; i++)
+  {
+    *min = fminf(*min, data[i]);
+    *max = fmaxf(*max, data[i]);
+  }
+}
+
+double getMean(const float* data, uint64_t length)
+{
+  const uint64_t vectorLength = length & ~(uint64_t)3;
+  double sum = 0;
+  uint64_t i;
+
+  for(uint64_t start = 0; start < vectorLength; start += DFT_BLOCK)
+  {
+    const uint64_t end = start + DFT_BLOCK < vectorLength ? start + DFT_BLOCK : vectorLength;
+    v4sf acc = {0};
+
+    for(i = start; i < end; i += 4)
+    {
+      v4sf x;
+      memcpy(&x, data + i, sizeof(x));
+      acc += x;
+    }
+
+    sum += (acc[0] + acc[1]) + (acc[2] + acc[3]);
+  }
+
+  for(i = vectorLength; i < length; i++)
+    sum += data[i];
+
+  return length > 0 ? sum / length : 0;
+}
+
+double findCrossing(const float* data, uint64_t length, float level, bool8_t rising)
+{
+  uint64_t i = 1;
+
+  // Compare each sample with its predecessor, four at a time, until one crosses:
+  if(length > 4)
+  {
+    const uint64_t vectorEnd = 1 + ((length - 1) & ~(uint64_t)3);
+
+    for(; i < vectorEnd; i += 4)
+    {
+      v4sf previous, x;
+      v4si crossed;
+      memcpy(&previous, data + i - 1, sizeof(previous));
+      memcpy(&x, data + i, sizeof(x));
+
+      if(rising)
+        crossed = (previous < level) & (x >= level);
+      else
+        crossed = (previous > level) & (x <= level);
+
+      if(crossed[0] | crossed[1] | crossed[2] | crossed[3])
+        break;
+    }
+  }
+
+  for(; i < length; i++)
+  {
+    const float previous = data[i - 1];
+    const float x = data[i];
+
+    if(rising ? (previous < level && x >= level) : (previous > level && x <= level))
+      return (i - 1) + (double)(level - previous) / (x - previous);
+  }
+
+  return -1;
+}
+
+uint64_t findDeviation(const float* data, uint64_t length, float baseline, float threshold)
+{
+  const uint64_t vectorLength = length & ~(uint64_t)3;
+  uint64_t i = 0;
+
+  for(; i < vectorLength; i += 4)
+  {
+    v4sf x;
+    memcpy(&x, data + i, sizeof(x));
+    x -= baseline;
+
+    const v4si deviates = (x > threshold) | (x < -threshold);
+    if(deviates[0] | deviates[1] | deviates[2] | deviates[3])
+      break;
+  }
+
+  for(; i < length; i++)
+  {
+    if(fabsf(data[i] - baseline) > threshold)
+      return i;
+  }
+
+  return length;
+}
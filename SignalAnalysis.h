@@ -0,0 +1,45 @@
+/**
+ * SignalAnalysis.h
+ *
+ * This file is part of the LibTiePie programming examples.
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#ifndef _SIGNALANALYSIS_H_
+#define _SIGNALANALYSIS_H_
+
+#include <stdint.h>
+#include <libtiepie.h>
+
+// Single frequency and edge analysis of measured data, four samples at a time.
+// The DFT bin is computed four samples at a time with a rotating phasor, that is resynchronized every block to limit rounding errors.
+
+typedef struct
+{
+  double re;
+  double im;
+} Complex_t;
+
+// DFT at one frequency, in cycles per sample, the frequency doesn't need to be a multiple of 1 / length:
+Complex_t dftBin(const float* data, uint64_t length, double frequency);
+
+// Same with a Hann window, to reduce leakage when the data doesn't contain a whole number of periods:
+Complex_t dftBinHann(const float* data, uint64_t length, double frequency);
+
+// Gain (dB) and phase (degrees, -180..180) of signal relative to reference:
+void getGainPhase(Complex_t signal, Complex_t reference, double* gain, double* phase);
+
+// Minimum and maximum value:
+void getMinMax(const float* data, uint64_t length, float* min, float* max);
+
+// Mean value:
+double getMean(const float* data, uint64_t length);
+
+// Position of the first crossing of level, interpolated between samples. Returns -1 if there is none:
+double findCrossing(const float* data, uint64_t length, float level, bool8_t rising);
+
+// Index of the first sample that differs more than threshold from baseline. Returns length if there is none:
+uint64_t findDeviation(const float* data, uint64_t length, float baseline, float threshold);
+
+#endif
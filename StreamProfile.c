@@ -0,0 +1,121 @@
+/**
+ * StreamProfile.c
+ *
+ * This file is part of the LibTiePie programming examples.
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#include "StreamProfile.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+#include "Utils.h"
+
+#define LINE_LENGTH 256
+
+// Parse a profile line. Returns BOOL8_FALSE for empty lines, comments and invalid lines:
+static bool8_t parseLine(const char* line, StreamProfile_t* profile)
+{
+  char first;
+
+  if(sscanf(line, " %c", &first) != 1 || first == '#')
+    return BOOL8_FALSE;
+
+  return sscanf(line, "%" SCNu32 " %" SCNu16 " %lf %" SCNu64, &profile->serialNumber, &profile->channelCount, &profile->sampleFrequency, &profile->recordLength) == 4 && profile->sampleFrequency > 0 && profile->recordLength > 0;
+}
+
+bool8_t loadStreamProfile(StreamProfile_t* profile, const char* filename, uint32_t serialNumber, uint16_t channelCount)
+{
+  FILE* file = fopen(filename, "r");
+  if(!file)
+    return BOOL8_FALSE;
+
+  bool8_t found = BOOL8_FALSE;
+  char line[LINE_LENGTH];
+
+  while(!found && fgets(line, sizeof(line), file))
+  {
+    StreamProfile_t candidate;
+
+    if(parseLine(line, &candidate) && candidate.serialNumber == serialNumber && candidate.channelCount == channelCount)
+    {
+      *profile = candidate;
+      found = BOOL8_TRUE;
+    }
+  }
+
+  fclose(file);
+
+  return found;
+}
+
+bool8_t saveStreamProfile(const StreamProfile_t* profile, const char* filename)
+{
+  char* lines = NULL;
+  size_t size = 0;
+  size_t capacity = 0;
+
+  // Keep the other lines of an existing file:
+  FILE* file = fopen(filename, "r");
+  if(file)
+  {
+    char line[LINE_LENGTH];
+
+    while(fgets(line, sizeof(line), file))
+    {
+      StreamProfile_t other;
+      const size_t length = strlen(line);
+
+      if(parseLine(line, &other) && other.serialNumber == profile->serialNumber && other.channelCount == profile->channelCount)
+        continue;
+
+      if(size + length + 1 > capacity)
+      {
+        capacity = capacity ? capacity * 2 : 4096;
+        char* newLines = realloc(lines, capacity);
+        if(!newLines)
+        {
+          fclose(file);
+          free(lines);
+          fprintf(stderr, "Out of memory!" NEWLINE);
+          return BOOL8_FALSE;
+        }
+        lines = newLines;
+      }
+
+      memcpy(lines + size, line, length + 1);
+      size += length;
+    }
+
+    fclose(file);
+  }
+
+  file = fopen(filename, "w");
+  if(!file)
+  {
+    free(lines);
+    fprintf(stderr, "Couldn't open file: %s" NEWLINE, filename);
+    return BOOL8_FALSE;
+  }
+
+  if(size == 0)
+    fprintf(file, "# serialNumber channelCount sampleFrequency recordLength" NEWLINE);
+  else
+    fwrite(lines, 1, size, file);
+
+  if(size > 0 && lines[size - 1] != '\n')
+    fprintf(file, NEWLINE);
+
+  fprintf(file, "%" PRIu32 " %" PRIu16 " %.17g %" PRIu64 NEWLINE, profile->serialNumber, profile->channelCount, profile->sampleFrequency, profile->recordLength);
+
+  free(lines);
+
+  const int error = ferror(file);
+  const bool8_t ok = fclose(file) == 0 && !error ? BOOL8_TRUE : BOOL8_FALSE;
+  if(!ok)
+    fprintf(stderr, "Couldn't write file: %s" NEWLINE, filename);
+
+  return ok;
+}
@@ -0,0 +1,33 @@
+/**
+ * StreamProfile.h
+ *
+ * This file is part of the LibTiePie programming examples.
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#ifndef _STREAMPROFILE_H_
+#define _STREAMPROFILE_H_
+
+#include <libtiepie.h>
+
+// Stream settings that were found sustainable, persisted per oscilloscope and number of enabled channels.
+// The profile file has one line per oscilloscope and channel count:
+//   serialNumber channelCount sampleFrequency recordLength
+// Empty lines and lines starting with # are skipped.
+
+typedef struct
+{
+  uint32_t serialNumber;
+  uint16_t channelCount; // Enabled channels.
+  double sampleFrequency; // Hz
+  uint64_t recordLength; // Samples per chunk.
+} StreamProfile_t;
+
+// Find the profile for serialNumber and channelCount. Returns BOOL8_FALSE if there is none:
+bool8_t loadStreamProfile(StreamProfile_t* profile, const char* filename, uint32_t serialNumber, uint16_t channelCount);
+
+// Add or replace the profile, other profiles in the file are kept. Errors are printed to stderr. Returns BOOL8_FALSE on error:
+bool8_t saveStreamProfile(const StreamProfile_t* profile, const char* filename);
+
+#endif
@@ -0,0 +1,119 @@
+/**
+ * Sweep.c
+ *
+ * This file is part of the LibTiePie programming examples.
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#include "Sweep.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include "Utils.h"
+
+bool8_t createSweep(Sweep_t* sweep, int kind, uint32_t count, double startFrequency, double stopFrequency, double startAmplitude, double stopAmplitude, double offset)
+{
+  sweep->count = 0;
+  sweep->points = NULL;
+
+  if(count == 0 || (kind == SWEEP_LOG && (startFrequency <= 0 || stopFrequency <= 0 || startAmplitude <= 0 || stopAmplitude <= 0)))
+    return BOOL8_FALSE;
+
+  sweep->points = malloc(sizeof(SweepPoint_t) * count);
+  if(!sweep->points)
+    return BOOL8_FALSE;
+
+  for(uint32_t i = 0; i < count; i++)
+  {
+    const double x = count > 1 ? (double)i / (count - 1) : 0;
+    SweepPoint_t* point = &sweep->points[i];
+
+    if(kind == SWEEP_LOG)
+    {
+      point->frequency = startFrequency * pow(stopFrequency / startFrequency, x);
+      point->amplitude = startAmplitude * pow(stopAmplitude / startAmplitude, x);
+    }
+    else
+    {
+      point->frequency = startFrequency + (stopFrequency - startFrequency) * x;
+      point->amplitude = startAmplitude + (stopAmplitude - startAmplitude) * x;
+    }
+    point->offset = offset;
+  }
+
+  sweep->count = count;
+
+  return BOOL8_TRUE;
+}
+
+bool8_t loadSweep(Sweep_t* sweep, const char* filename)
+{
+  sweep->count = 0;
+  sweep->points = NULL;
+
+  FILE* file = fopen(filename, "r");
+  if(!file)
+  {
+    fprintf(stderr, "Couldn't open file: %s" NEWLINE, filename);
+    return BOOL8_FALSE;
+  }
+
+  SweepPoint_t point = {0, 1, 0};
+  uint32_t capacity = 0;
+  bool8_t ok = BOOL8_TRUE;
+  unsigned int lineNumber = 0;
+  char line[256];
+
+  while(ok && fgets(line, sizeof(line), file))
+  {
+    char first;
+
+    lineNumber++;
+
+    // Skip empty lines and comments:
+    if(sscanf(line, " %c", &first) != 1 || first == '#')
+      continue;
+
+    if(sscanf(line, "%lf %lf %lf", &point.frequency, &point.amplitude, &point.offset) < 1 || point.frequency <= 0)
+    {
+      fprintf(stderr, "%s:%u Expected frequency [amplitude [offset]]" NEWLINE, filename, lineNumber);
+      ok = BOOL8_FALSE;
+      break;
+    }
+
+    if(sweep->count == capacity)
+    {
+      capacity = capacity ? capacity * 2 : 256;
+      SweepPoint_t* points = realloc(sweep->points, sizeof(SweepPoint_t) * capacity);
+      if(!points)
+      {
+        ok = BOOL8_FALSE;
+        break;
+      }
+      sweep->points = points;
+    }
+
+    sweep->points[sweep->count++] = point;
+  }
+
+  fclose(file);
+
+  if(ok && sweep->count == 0)
+  {
+    fprintf(stderr, "%s: No points" NEWLINE, filename);
+    ok = BOOL8_FALSE;
+  }
+
+  if(!ok)
+    freeSweep(sweep);
+
+  return ok;
+}
+
+void freeSweep(Sweep_t* sweep)
+{
+  free(sweep->points);
+  sweep->points = NULL;
+  sweep->count = 0;
+}
@@ -0,0 +1,44 @@
+/**
+ * Sweep.h
+ *
+ * This file is part of the LibTiePie programming examples.
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#ifndef _SWEEP_H_
+#define _SWEEP_H_
+
+#include <libtiepie.h>
+
+// Frequency/amplitude sweeps for the generator.
+// Points are spaced linearly or logarithmically, or read from a list file with one point per line:
+//   frequency [amplitude [offset]]
+// Missing values repeat the previous point, empty lines and lines starting with # are skipped.
+
+// Sweep kinds:
+#define SWEEP_LINEAR 0
+#define SWEEP_LOG 1
+
+typedef struct
+{
+  double frequency; // Hz
+  double amplitude; // V
+  double offset; // V
+} SweepPoint_t;
+
+typedef struct
+{
+  uint32_t count;
+  SweepPoint_t* points;
+} Sweep_t;
+
+// Create count points from start to stop, log sweeps need positive frequencies and amplitudes. Returns BOOL8_FALSE on error:
+bool8_t createSweep(Sweep_t* sweep, int kind, uint32_t count, double startFrequency, double stopFrequency, double startAmplitude, double stopAmplitude, double offset);
+
+// Load a list file, errors are printed to stderr. Returns BOOL8_FALSE on error:
+bool8_t loadSweep(Sweep_t* sweep, const char* filename);
+
+void freeSweep(Sweep_t* sweep);
+
+#endif
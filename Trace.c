@@ -0,0 +1,219 @@
+/**
+ * Trace.c
+ *
+ * This file is part of the LibTiePie programming examples.
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#include "Trace.h"
+
+#ifdef LIBTIEPIE_TRACE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include "Utils.h"
+
+typedef struct
+{
+  uint64_t count;
+  uint64_t total;
+  uint64_t min;
+  uint64_t max;
+  uint64_t histogram[TRACE_HISTOGRAM_BUCKETS];
+} TraceStats_t;
+
+typedef struct TraceBuffer
+{
+  TraceStats_t stats[TRACE_FUNCTION_MAX];
+  struct TraceBuffer* next;
+} TraceBuffer_t;
+
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static const char* functions[TRACE_FUNCTION_MAX]; // Index 0 is unused, it marks an unregistered function.
+static unsigned int functionCount = 1;
+static TraceBuffer_t* buffers = NULL; // All thread buffers, kept until exit so the report includes finished threads.
+static __thread TraceBuffer_t* threadBuffer = NULL;
+
+unsigned int traceRegister(const char* name)
+{
+  unsigned int id = 0;
+
+  pthread_mutex_lock(&lock);
+
+  // Another thread may have registered it already:
+  for(unsigned int i = 1; i < functionCount; i++)
+  {
+    if(strcmp(functions[i], name) == 0)
+    {
+      id = i;
+      break;
+    }
+  }
+
+  if(id == 0 && functionCount < TRACE_FUNCTION_MAX)
+  {
+    id = functionCount++;
+    functions[id] = name;
+  }
+
+  pthread_mutex_unlock(&lock);
+
+  return id;
+}
+
+uint64_t traceNow()
+{
+  return getTimeNanoSeconds();
+}
+
+static TraceBuffer_t* getBuffer()
+{
+  if(!threadBuffer)
+  {
+    threadBuffer = calloc(1, sizeof(TraceBuffer_t));
+    if(!threadBuffer)
+      return NULL;
+
+    pthread_mutex_lock(&lock);
+    threadBuffer->next = buffers;
+    buffers = threadBuffer;
+    pthread_mutex_unlock(&lock);
+  }
+
+  return threadBuffer;
+}
+
+void traceEnd(TraceScope_t* scope)
+{
+  const uint64_t duration = traceNow() - scope->start;
+
+  if(scope->function == 0)
+    return;
+
+  TraceBuffer_t* buffer = getBuffer();
+  if(!buffer)
+    return;
+
+  TraceStats_t* stats = &buffer->stats[scope->function];
+
+  if(stats->count == 0 || duration < stats->min)
+    stats->min = duration;
+  if(duration > stats->max)
+    stats->max = duration;
+  stats->count++;
+  stats->total += duration;
+
+  unsigned int bucket = duration == 0 ? 0 : 64 - __builtin_clzll(duration);
+  if(bucket >= TRACE_HISTOGRAM_BUCKETS)
+    bucket = TRACE_HISTOGRAM_BUCKETS - 1;
+  stats->histogram[bucket]++;
+}
+
+// Upper bound of the histogram bucket containing the given fraction of the calls:
+static uint64_t getPercentile(const TraceStats_t* stats, double fraction)
+{
+  const uint64_t target = (uint64_t)(stats->count * fraction + 0.5);
+  uint64_t sum = 0;
+
+  for(unsigned int i = 0; i < TRACE_HISTOGRAM_BUCKETS - 1; i++)
+  {
+    sum += stats->histogram[i];
+    if(sum >= target)
+      return (1ULL << i) < stats->max ? (1ULL << i) : stats->max;
+  }
+
+  return stats->max;
+}
+
+void printTraceReport()
+{
+  static TraceStats_t merged[TRACE_FUNCTION_MAX];
+  static unsigned int ids[TRACE_FUNCTION_MAX];
+  static TraceStats_t sorted[TRACE_FUNCTION_MAX];
+  unsigned int threads = 0;
+  unsigned int count = 0;
+
+  memset(merged, 0, sizeof(merged));
+
+  pthread_mutex_lock(&lock);
+
+  // Merge the thread buffers:
+  for(const TraceBuffer_t* buffer = buffers; buffer; buffer = buffer->next)
+  {
+    threads++;
+    for(unsigned int i = 1; i < functionCount; i++)
+    {
+      const TraceStats_t* stats = &buffer->stats[i];
+
+      if(stats->count == 0)
+        continue;
+
+      if(merged[i].count == 0 || stats->min < merged[i].min)
+        merged[i].min = stats->min;
+      if(stats->max > merged[i].max)
+        merged[i].max = stats->max;
+      merged[i].count += stats->count;
+      merged[i].total += stats->total;
+      for(unsigned int j = 0; j < TRACE_HISTOGRAM_BUCKETS; j++)
+        merged[i].histogram[j] += stats->histogram[j];
+    }
+  }
+
+  // Sort by total time, most expensive first:
+  for(unsigned int i = 1; i < functionCount; i++)
+  {
+    if(merged[i].count == 0)
+      continue;
+
+    unsigned int j = count;
+    for(; j > 0 && sorted[j - 1].total < merged[i].total; j--)
+    {
+      sorted[j] = sorted[j - 1];
+      ids[j] = ids[j - 1];
+    }
+    sorted[j] = merged[i];
+    ids[j] = i;
+    count++;
+  }
+
+  fprintf(stderr, NEWLINE "LibTiePie call trace (%u thread%s, times in us):" NEWLINE, threads, threads == 1 ? "" : "s");
+  fprintf(stderr, "  %-40s %10s %12s %10s %10s %10s %10s %10s" NEWLINE, "Function", "Calls", "Total", "Mean", "Min", "p50", "p99", "Max");
+
+  for(unsigned int i = 0; i < count; i++)
+  {
+    const TraceStats_t* stats = &sorted[i];
+
+    fprintf(stderr, "  %-40s %10" PRIu64 " %12.1f %10.2f %10.2f %10.2f %10.2f %10.2f" NEWLINE,
+            functions[ids[i]],
+            stats->count,
+            stats->total / 1e3,
+            (double)stats->total / stats->count / 1e3,
+            stats->min / 1e3,
+            getPercentile(stats, 0.50) / 1e3,
+            getPercentile(stats, 0.99) / 1e3,
+            stats->max / 1e3);
+  }
+
+  // Latency histograms, one row per function, one column per power of two:
+  fprintf(stderr, NEWLINE "Latency histograms (calls per bucket, bucket n is < 2^n ns):" NEWLINE);
+  for(unsigned int i = 0; i < count; i++)
+  {
+    const TraceStats_t* stats = &sorted[i];
+
+    fprintf(stderr, "  %-40s", functions[ids[i]]);
+    for(unsigned int j = 0; j < TRACE_HISTOGRAM_BUCKETS; j++)
+    {
+      if(stats->histogram[j] > 0)
+        fprintf(stderr, " %u:%" PRIu64, j, stats->histogram[j]);
+    }
+    fprintf(stderr, NEWLINE);
+  }
+
+  pthread_mutex_unlock(&lock);
+}
+
+#endif
@@ -0,0 +1,272 @@
+/**
+ * Trace.h
+ *
+ * This file is part of the LibTiePie programming examples.
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#ifndef _TRACE_H_
+#define _TRACE_H_
+
+#include <libtiepie.h>
+
+// Per call latency tracing of the Lst*, Scp*, Gen* and I2C* functions.
+// Enabled at compile time by defining LIBTIEPIE_TRACE and force including this file (make TRACE=1),
+// every call is then timed and counted in a per thread table. The report is printed to stderr when LibExit() is called.
+// Without LIBTIEPIE_TRACE nothing is wrapped, so there is no overhead at all.
+
+#ifdef LIBTIEPIE_TRACE
+
+#include <stdint.h>
+
+#define TRACE_FUNCTION_MAX 256
+#define TRACE_HISTOGRAM_BUCKETS 32 // Bucket n holds calls taking [2^(n-1), 2^n) ns, the last one everything above.
+
+typedef struct
+{
+  unsigned int function;
+  uint64_t start;
+} TraceScope_t;
+
+unsigned int traceRegister(const char* name); // Returns function id, 0 if the table is full.
+uint64_t traceNow();
+void traceEnd(TraceScope_t* scope);
+void printTraceReport();
+
+#define TRACE_CALL(name, call) \
+  ({ \
+    static unsigned int traceFunction_; \
+    unsigned int traceId_ = __atomic_load_n(&traceFunction_, __ATOMIC_RELAXED); \
+    if(traceId_ == 0) \
+    { \
+      traceId_ = traceRegister(#name); \
+      __atomic_store_n(&traceFunction_, traceId_, __ATOMIC_RELAXED); \
+    } \
+    TraceScope_t traceScope_ __attribute__((cleanup(traceEnd))) = {traceId_, traceNow()}; \
+    call; \
+  })
+
+// Print the report before the library is unloaded:
+#define LibExit() (printTraceReport(), LibExit())
+
+#define GenGetAmplitude(...) TRACE_CALL(GenGetAmplitude, GenGetAmplitude(__VA_ARGS__))
+#define GenGetAmplitudeAutoRanging(...) TRACE_CALL(GenGetAmplitudeAutoRanging, GenGetAmplitudeAutoRanging(__VA_ARGS__))
+#define GenGetAmplitudeMax(...) TRACE_CALL(GenGetAmplitudeMax, GenGetAmplitudeMax(__VA_ARGS__))
+#define GenGetAmplitudeMin(...) TRACE_CALL(GenGetAmplitudeMin, GenGetAmplitudeMin(__VA_ARGS__))
+#define GenGetAmplitudeRange(...) TRACE_CALL(GenGetAmplitudeRange, GenGetAmplitudeRange(__VA_ARGS__))
+#define GenGetAmplitudeRanges(...) TRACE_CALL(GenGetAmplitudeRanges, GenGetAmplitudeRanges(__VA_ARGS__))
+#define GenGetBurstCount(...) TRACE_CALL(GenGetBurstCount, GenGetBurstCount(__VA_ARGS__))
+#define GenGetBurstCountMax(...) TRACE_CALL(GenGetBurstCountMax, GenGetBurstCountMax(__VA_ARGS__))
+#define GenGetBurstCountMin(...) TRACE_CALL(GenGetBurstCountMin, GenGetBurstCountMin(__VA_ARGS__))
+#define GenGetBurstSampleCount(...) TRACE_CALL(GenGetBurstSampleCount, GenGetBurstSampleCount(__VA_ARGS__))
+#define GenGetBurstSampleCountMax(...) TRACE_CALL(GenGetBurstSampleCountMax, GenGetBurstSampleCountMax(__VA_ARGS__))
+#define GenGetBurstSegmentCount(...) TRACE_CALL(GenGetBurstSegmentCount, GenGetBurstSegmentCount(__VA_ARGS__))
+#define GenGetBurstSegmentCountMax(...) TRACE_CALL(GenGetBurstSegmentCountMax, GenGetBurstSegmentCountMax(__VA_ARGS__))
+#define GenGetConnectorType(...) TRACE_CALL(GenGetConnectorType, GenGetConnectorType(__VA_ARGS__))
+#define GenGetDataLength(...) TRACE_CALL(GenGetDataLength, GenGetDataLength(__VA_ARGS__))
+#define GenGetDataLengthMax(...) TRACE_CALL(GenGetDataLengthMax, GenGetDataLengthMax(__VA_ARGS__))
+#define GenGetDataLengthMin(...) TRACE_CALL(GenGetDataLengthMin, GenGetDataLengthMin(__VA_ARGS__))
+#define GenGetFrequency(...) TRACE_CALL(GenGetFrequency, GenGetFrequency(__VA_ARGS__))
+#define GenGetFrequencyMax(...) TRACE_CALL(GenGetFrequencyMax, GenGetFrequencyMax(__VA_ARGS__))
+#define GenGetFrequencyMin(...) TRACE_CALL(GenGetFrequencyMin, GenGetFrequencyMin(__VA_ARGS__))
+#define GenGetFrequencyMode(...) TRACE_CALL(GenGetFrequencyMode, GenGetFrequencyMode(__VA_ARGS__))
+#define GenGetFrequencyModes(...) TRACE_CALL(GenGetFrequencyModes, GenGetFrequencyModes(__VA_ARGS__))
+#define GenGetImpedance(...) TRACE_CALL(GenGetImpedance, GenGetImpedance(__VA_ARGS__))
+#define GenGetLeadingEdgeTime(...) TRACE_CALL(GenGetLeadingEdgeTime, GenGetLeadingEdgeTime(__VA_ARGS__))
+#define GenGetLeadingEdgeTimeMax(...) TRACE_CALL(GenGetLeadingEdgeTimeMax, GenGetLeadingEdgeTimeMax(__VA_ARGS__))
+#define GenGetLeadingEdgeTimeMin(...) TRACE_CALL(GenGetLeadingEdgeTimeMin, GenGetLeadingEdgeTimeMin(__VA_ARGS__))
+#define GenGetMode(...) TRACE_CALL(GenGetMode, GenGetMode(__VA_ARGS__))
+#define GenGetModes(...) TRACE_CALL(GenGetModes, GenGetModes(__VA_ARGS__))
+#define GenGetModesNative(...) TRACE_CALL(GenGetModesNative, GenGetModesNative(__VA_ARGS__))
+#define GenGetOffset(...) TRACE_CALL(GenGetOffset, GenGetOffset(__VA_ARGS__))
+#define GenGetOffsetMax(...) TRACE_CALL(GenGetOffsetMax, GenGetOffsetMax(__VA_ARGS__))
+#define GenGetOffsetMin(...) TRACE_CALL(GenGetOffsetMin, GenGetOffsetMin(__VA_ARGS__))
+#define GenGetOutputInvert(...) TRACE_CALL(GenGetOutputInvert, GenGetOutputInvert(__VA_ARGS__))
+#define GenGetOutputOn(...) TRACE_CALL(GenGetOutputOn, GenGetOutputOn(__VA_ARGS__))
+#define GenGetOutputValueMax(...) TRACE_CALL(GenGetOutputValueMax, GenGetOutputValueMax(__VA_ARGS__))
+#define GenGetOutputValueMin(...) TRACE_CALL(GenGetOutputValueMin, GenGetOutputValueMin(__VA_ARGS__))
+#define GenGetPhase(...) TRACE_CALL(GenGetPhase, GenGetPhase(__VA_ARGS__))
+#define GenGetPhaseMax(...) TRACE_CALL(GenGetPhaseMax, GenGetPhaseMax(__VA_ARGS__))
+#define GenGetPhaseMin(...) TRACE_CALL(GenGetPhaseMin, GenGetPhaseMin(__VA_ARGS__))
+#define GenGetResolution(...) TRACE_CALL(GenGetResolution, GenGetResolution(__VA_ARGS__))
+#define GenGetSignalType(...) TRACE_CALL(GenGetSignalType, GenGetSignalType(__VA_ARGS__))
+#define GenGetSignalTypes(...) TRACE_CALL(GenGetSignalTypes, GenGetSignalTypes(__VA_ARGS__))
+#define GenGetSymmetry(...) TRACE_CALL(GenGetSymmetry, GenGetSymmetry(__VA_ARGS__))
+#define GenGetSymmetryMax(...) TRACE_CALL(GenGetSymmetryMax, GenGetSymmetryMax(__VA_ARGS__))
+#define GenGetSymmetryMin(...) TRACE_CALL(GenGetSymmetryMin, GenGetSymmetryMin(__VA_ARGS__))
+#define GenGetTrailingEdgeTime(...) TRACE_CALL(GenGetTrailingEdgeTime, GenGetTrailingEdgeTime(__VA_ARGS__))
+#define GenGetTrailingEdgeTimeMax(...) TRACE_CALL(GenGetTrailingEdgeTimeMax, GenGetTrailingEdgeTimeMax(__VA_ARGS__))
+#define GenGetTrailingEdgeTimeMin(...) TRACE_CALL(GenGetTrailingEdgeTimeMin, GenGetTrailingEdgeTimeMin(__VA_ARGS__))
+#define GenGetWidth(...) TRACE_CALL(GenGetWidth, GenGetWidth(__VA_ARGS__))
+#define GenGetWidthMax(...) TRACE_CALL(GenGetWidthMax, GenGetWidthMax(__VA_ARGS__))
+#define GenGetWidthMin(...) TRACE_CALL(GenGetWidthMin, GenGetWidthMin(__VA_ARGS__))
+#define GenHasAmplitude(...) TRACE_CALL(GenHasAmplitude, GenHasAmplitude(__VA_ARGS__))
+#define GenHasData(...) TRACE_CALL(GenHasData, GenHasData(__VA_ARGS__))
+#define GenHasEdgeTime(...) TRACE_CALL(GenHasEdgeTime, GenHasEdgeTime(__VA_ARGS__))
+#define GenHasFrequency(...) TRACE_CALL(GenHasFrequency, GenHasFrequency(__VA_ARGS__))
+#define GenHasOffset(...) TRACE_CALL(GenHasOffset, GenHasOffset(__VA_ARGS__))
+#define GenHasOutputInvert(...) TRACE_CALL(GenHasOutputInvert, GenHasOutputInvert(__VA_ARGS__))
+#define GenHasPhase(...) TRACE_CALL(GenHasPhase, GenHasPhase(__VA_ARGS__))
+#define GenHasSymmetry(...) TRACE_CALL(GenHasSymmetry, GenHasSymmetry(__VA_ARGS__))
+#define GenHasWidth(...) TRACE_CALL(GenHasWidth, GenHasWidth(__VA_ARGS__))
+#define GenIsBurstActive(...) TRACE_CALL(GenIsBurstActive, GenIsBurstActive(__VA_ARGS__))
+#define GenIsControllable(...) TRACE_CALL(GenIsControllable, GenIsControllable(__VA_ARGS__))
+#define GenIsDifferential(...) TRACE_CALL(GenIsDifferential, GenIsDifferential(__VA_ARGS__))
+#define GenIsRunning(...) TRACE_CALL(GenIsRunning, GenIsRunning(__VA_ARGS__))
+#define GenSetAmplitude(...) TRACE_CALL(GenSetAmplitude, GenSetAmplitude(__VA_ARGS__))
+#define GenSetBurstCount(...) TRACE_CALL(GenSetBurstCount, GenSetBurstCount(__VA_ARGS__))
+#define GenSetCallbackBurstCompleted(...) TRACE_CALL(GenSetCallbackBurstCompleted, GenSetCallbackBurstCompleted(__VA_ARGS__))
+#define GenSetData(...) TRACE_CALL(GenSetData, GenSetData(__VA_ARGS__))
+#define GenSetFrequency(...) TRACE_CALL(GenSetFrequency, GenSetFrequency(__VA_ARGS__))
+#define GenSetFrequencyMode(...) TRACE_CALL(GenSetFrequencyMode, GenSetFrequencyMode(__VA_ARGS__))
+#define GenSetMode(...) TRACE_CALL(GenSetMode, GenSetMode(__VA_ARGS__))
+#define GenSetOffset(...) TRACE_CALL(GenSetOffset, GenSetOffset(__VA_ARGS__))
+#define GenSetOutputOn(...) TRACE_CALL(GenSetOutputOn, GenSetOutputOn(__VA_ARGS__))
+#define GenSetPhase(...) TRACE_CALL(GenSetPhase, GenSetPhase(__VA_ARGS__))
+#define GenSetSignalType(...) TRACE_CALL(GenSetSignalType, GenSetSignalType(__VA_ARGS__))
+#define GenSetSymmetry(...) TRACE_CALL(GenSetSymmetry, GenSetSymmetry(__VA_ARGS__))
+#define GenSetWidth(...) TRACE_CALL(GenSetWidth, GenSetWidth(__VA_ARGS__))
+#define GenStart(...) TRACE_CALL(GenStart, GenStart(__VA_ARGS__))
+#define GenStop(...) TRACE_CALL(GenStop, GenStop(__VA_ARGS__))
+#define I2CGetInternalAddresses(...) TRACE_CALL(I2CGetInternalAddresses, I2CGetInternalAddresses(__VA_ARGS__))
+#define I2CGetSpeed(...) TRACE_CALL(I2CGetSpeed, I2CGetSpeed(__VA_ARGS__))
+#define I2CGetSpeedMax(...) TRACE_CALL(I2CGetSpeedMax, I2CGetSpeedMax(__VA_ARGS__))
+#define I2CIsInternalAddress(...) TRACE_CALL(I2CIsInternalAddress, I2CIsInternalAddress(__VA_ARGS__))
+#define I2CRead(...) TRACE_CALL(I2CRead, I2CRead(__VA_ARGS__))
+#define I2CReadByte(...) TRACE_CALL(I2CReadByte, I2CReadByte(__VA_ARGS__))
+#define I2CSetSpeed(...) TRACE_CALL(I2CSetSpeed, I2CSetSpeed(__VA_ARGS__))
+#define I2CWrite(...) TRACE_CALL(I2CWrite, I2CWrite(__VA_ARGS__))
+#define I2CWriteByte(...) TRACE_CALL(I2CWriteByte, I2CWriteByte(__VA_ARGS__))
+#define I2CWriteByteByte(...) TRACE_CALL(I2CWriteByteByte, I2CWriteByteByte(__VA_ARGS__))
+#define I2CWriteByteWord(...) TRACE_CALL(I2CWriteByteWord, I2CWriteByteWord(__VA_ARGS__))
+#define I2CWriteWord(...) TRACE_CALL(I2CWriteWord, I2CWriteWord(__VA_ARGS__))
+#define LstCreateAndOpenCombinedDevice(...) TRACE_CALL(LstCreateAndOpenCombinedDevice, LstCreateAndOpenCombinedDevice(__VA_ARGS__))
+#define LstDevCanOpen(...) TRACE_CALL(LstDevCanOpen, LstDevCanOpen(__VA_ARGS__))
+#define LstDevGetName(...) TRACE_CALL(LstDevGetName, LstDevGetName(__VA_ARGS__))
+#define LstDevGetProductId(...) TRACE_CALL(LstDevGetProductId, LstDevGetProductId(__VA_ARGS__))
+#define LstDevGetSerialNumber(...) TRACE_CALL(LstDevGetSerialNumber, LstDevGetSerialNumber(__VA_ARGS__))
+#define LstDevGetServer(...) TRACE_CALL(LstDevGetServer, LstDevGetServer(__VA_ARGS__))
+#define LstDevGetTypes(...) TRACE_CALL(LstDevGetTypes, LstDevGetTypes(__VA_ARGS__))
+#define LstDevHasServer(...) TRACE_CALL(LstDevHasServer, LstDevHasServer(__VA_ARGS__))
+#define LstGetCount(...) TRACE_CALL(LstGetCount, LstGetCount(__VA_ARGS__))
+#define LstOpenDevice(...) TRACE_CALL(LstOpenDevice, LstOpenDevice(__VA_ARGS__))
+#define LstOpenGenerator(...) TRACE_CALL(LstOpenGenerator, LstOpenGenerator(__VA_ARGS__))
+#define LstOpenI2CHost(...) TRACE_CALL(LstOpenI2CHost, LstOpenI2CHost(__VA_ARGS__))
+#define LstOpenOscilloscope(...) TRACE_CALL(LstOpenOscilloscope, LstOpenOscilloscope(__VA_ARGS__))
+#define LstRemoveDevice(...) TRACE_CALL(LstRemoveDevice, LstRemoveDevice(__VA_ARGS__))
+#define LstSetCallbackDeviceAdded(...) TRACE_CALL(LstSetCallbackDeviceAdded, LstSetCallbackDeviceAdded(__VA_ARGS__))
+#define LstSetCallbackDeviceCanOpenChanged(...) TRACE_CALL(LstSetCallbackDeviceCanOpenChanged, LstSetCallbackDeviceCanOpenChanged(__VA_ARGS__))
+#define LstSetCallbackDeviceRemoved(...) TRACE_CALL(LstSetCallbackDeviceRemoved, LstSetCallbackDeviceRemoved(__VA_ARGS__))
+#define LstUpdate(...) TRACE_CALL(LstUpdate, LstUpdate(__VA_ARGS__))
+#define ScpChGetAutoRanging(...) TRACE_CALL(ScpChGetAutoRanging, ScpChGetAutoRanging(__VA_ARGS__))
+#define ScpChGetBandwidth(...) TRACE_CALL(ScpChGetBandwidth, ScpChGetBandwidth(__VA_ARGS__))
+#define ScpChGetBandwidths(...) TRACE_CALL(ScpChGetBandwidths, ScpChGetBandwidths(__VA_ARGS__))
+#define ScpChGetConnectorType(...) TRACE_CALL(ScpChGetConnectorType, ScpChGetConnectorType(__VA_ARGS__))
+#define ScpChGetCoupling(...) TRACE_CALL(ScpChGetCoupling, ScpChGetCoupling(__VA_ARGS__))
+#define ScpChGetCouplings(...) TRACE_CALL(ScpChGetCouplings, ScpChGetCouplings(__VA_ARGS__))
+#define ScpChGetEnabled(...) TRACE_CALL(ScpChGetEnabled, ScpChGetEnabled(__VA_ARGS__))
+#define ScpChGetImpedance(...) TRACE_CALL(ScpChGetImpedance, ScpChGetImpedance(__VA_ARGS__))
+#define ScpChGetProbeGain(...) TRACE_CALL(ScpChGetProbeGain, ScpChGetProbeGain(__VA_ARGS__))
+#define ScpChGetProbeOffset(...) TRACE_CALL(ScpChGetProbeOffset, ScpChGetProbeOffset(__VA_ARGS__))
+#define ScpChGetRange(...) TRACE_CALL(ScpChGetRange, ScpChGetRange(__VA_ARGS__))
+#define ScpChGetRanges(...) TRACE_CALL(ScpChGetRanges, ScpChGetRanges(__VA_ARGS__))
+#define ScpChGetSafeGroundEnabled(...) TRACE_CALL(ScpChGetSafeGroundEnabled, ScpChGetSafeGroundEnabled(__VA_ARGS__))
+#define ScpChGetSafeGroundThreshold(...) TRACE_CALL(ScpChGetSafeGroundThreshold, ScpChGetSafeGroundThreshold(__VA_ARGS__))
+#define ScpChGetSafeGroundThresholdMax(...) TRACE_CALL(ScpChGetSafeGroundThresholdMax, ScpChGetSafeGroundThresholdMax(__VA_ARGS__))
+#define ScpChGetSafeGroundThresholdMin(...) TRACE_CALL(ScpChGetSafeGroundThresholdMin, ScpChGetSafeGroundThresholdMin(__VA_ARGS__))
+#define ScpChHasConnectionTest(...) TRACE_CALL(ScpChHasConnectionTest, ScpChHasConnectionTest(__VA_ARGS__))
+#define ScpChHasSafeGround(...) TRACE_CALL(ScpChHasSafeGround, ScpChHasSafeGround(__VA_ARGS__))
+#define ScpChHasTrigger(...) TRACE_CALL(ScpChHasTrigger, ScpChHasTrigger(__VA_ARGS__))
+#define ScpChIsAvailable(...) TRACE_CALL(ScpChIsAvailable, ScpChIsAvailable(__VA_ARGS__))
+#define ScpChIsDifferential(...) TRACE_CALL(ScpChIsDifferential, ScpChIsDifferential(__VA_ARGS__))
+#define ScpChSetAutoRanging(...) TRACE_CALL(ScpChSetAutoRanging, ScpChSetAutoRanging(__VA_ARGS__))
+#define ScpChSetBandwidth(...) TRACE_CALL(ScpChSetBandwidth, ScpChSetBandwidth(__VA_ARGS__))
+#define ScpChSetCoupling(...) TRACE_CALL(ScpChSetCoupling, ScpChSetCoupling(__VA_ARGS__))
+#define ScpChSetEnabled(...) TRACE_CALL(ScpChSetEnabled, ScpChSetEnabled(__VA_ARGS__))
+#define ScpChSetProbeGain(...) TRACE_CALL(ScpChSetProbeGain, ScpChSetProbeGain(__VA_ARGS__))
+#define ScpChSetProbeOffset(...) TRACE_CALL(ScpChSetProbeOffset, ScpChSetProbeOffset(__VA_ARGS__))
+#define ScpChSetRange(...) TRACE_CALL(ScpChSetRange, ScpChSetRange(__VA_ARGS__))
+#define ScpChTrGetCondition(...) TRACE_CALL(ScpChTrGetCondition, ScpChTrGetCondition(__VA_ARGS__))
+#define ScpChTrGetConditions(...) TRACE_CALL(ScpChTrGetConditions, ScpChTrGetConditions(__VA_ARGS__))
+#define ScpChTrGetEnabled(...) TRACE_CALL(ScpChTrGetEnabled, ScpChTrGetEnabled(__VA_ARGS__))
+#define ScpChTrGetHysteresis(...) TRACE_CALL(ScpChTrGetHysteresis, ScpChTrGetHysteresis(__VA_ARGS__))
+#define ScpChTrGetHysteresisCount(...) TRACE_CALL(ScpChTrGetHysteresisCount, ScpChTrGetHysteresisCount(__VA_ARGS__))
+#define ScpChTrGetKind(...) TRACE_CALL(ScpChTrGetKind, ScpChTrGetKind(__VA_ARGS__))
+#define ScpChTrGetKinds(...) TRACE_CALL(ScpChTrGetKinds, ScpChTrGetKinds(__VA_ARGS__))
+#define ScpChTrGetLevel(...) TRACE_CALL(ScpChTrGetLevel, ScpChTrGetLevel(__VA_ARGS__))
+#define ScpChTrGetLevelCount(...) TRACE_CALL(ScpChTrGetLevelCount, ScpChTrGetLevelCount(__VA_ARGS__))
+#define ScpChTrGetLevelMode(...) TRACE_CALL(ScpChTrGetLevelMode, ScpChTrGetLevelMode(__VA_ARGS__))
+#define ScpChTrGetLevelModes(...) TRACE_CALL(ScpChTrGetLevelModes, ScpChTrGetLevelModes(__VA_ARGS__))
+#define ScpChTrGetTime(...) TRACE_CALL(ScpChTrGetTime, ScpChTrGetTime(__VA_ARGS__))
+#define ScpChTrGetTimeCount(...) TRACE_CALL(ScpChTrGetTimeCount, ScpChTrGetTimeCount(__VA_ARGS__))
+#define ScpChTrIsAvailable(...) TRACE_CALL(ScpChTrIsAvailable, ScpChTrIsAvailable(__VA_ARGS__))
+#define ScpChTrSetCondition(...) TRACE_CALL(ScpChTrSetCondition, ScpChTrSetCondition(__VA_ARGS__))
+#define ScpChTrSetEnabled(...) TRACE_CALL(ScpChTrSetEnabled, ScpChTrSetEnabled(__VA_ARGS__))
+#define ScpChTrSetHysteresis(...) TRACE_CALL(ScpChTrSetHysteresis, ScpChTrSetHysteresis(__VA_ARGS__))
+#define ScpChTrSetKind(...) TRACE_CALL(ScpChTrSetKind, ScpChTrSetKind(__VA_ARGS__))
+#define ScpChTrSetLevel(...) TRACE_CALL(ScpChTrSetLevel, ScpChTrSetLevel(__VA_ARGS__))
+#define ScpChTrSetLevelMode(...) TRACE_CALL(ScpChTrSetLevelMode, ScpChTrSetLevelMode(__VA_ARGS__))
+#define ScpChTrSetTime(...) TRACE_CALL(ScpChTrSetTime, ScpChTrSetTime(__VA_ARGS__))
+#define ScpForceTrigger(...) TRACE_CALL(ScpForceTrigger, ScpForceTrigger(__VA_ARGS__))
+#define ScpGetAutoResolutionMode(...) TRACE_CALL(ScpGetAutoResolutionMode, ScpGetAutoResolutionMode(__VA_ARGS__))
+#define ScpGetAutoResolutionModes(...) TRACE_CALL(ScpGetAutoResolutionModes, ScpGetAutoResolutionModes(__VA_ARGS__))
+#define ScpGetChannelCount(...) TRACE_CALL(ScpGetChannelCount, ScpGetChannelCount(__VA_ARGS__))
+#define ScpGetClockOutput(...) TRACE_CALL(ScpGetClockOutput, ScpGetClockOutput(__VA_ARGS__))
+#define ScpGetClockOutputFrequencies(...) TRACE_CALL(ScpGetClockOutputFrequencies, ScpGetClockOutputFrequencies(__VA_ARGS__))
+#define ScpGetClockOutputFrequency(...) TRACE_CALL(ScpGetClockOutputFrequency, ScpGetClockOutputFrequency(__VA_ARGS__))
+#define ScpGetClockOutputs(...) TRACE_CALL(ScpGetClockOutputs, ScpGetClockOutputs(__VA_ARGS__))
+#define ScpGetClockSource(...) TRACE_CALL(ScpGetClockSource, ScpGetClockSource(__VA_ARGS__))
+#define ScpGetClockSourceFrequencies(...) TRACE_CALL(ScpGetClockSourceFrequencies, ScpGetClockSourceFrequencies(__VA_ARGS__))
+#define ScpGetClockSourceFrequency(...) TRACE_CALL(ScpGetClockSourceFrequency, ScpGetClockSourceFrequency(__VA_ARGS__))
+#define ScpGetClockSources(...) TRACE_CALL(ScpGetClockSources, ScpGetClockSources(__VA_ARGS__))
+#define ScpGetConnectionTestData(...) TRACE_CALL(ScpGetConnectionTestData, ScpGetConnectionTestData(__VA_ARGS__))
+#define ScpGetData(...) TRACE_CALL(ScpGetData, ScpGetData(__VA_ARGS__))
+#define ScpGetMeasureMode(...) TRACE_CALL(ScpGetMeasureMode, ScpGetMeasureMode(__VA_ARGS__))
+#define ScpGetMeasureModes(...) TRACE_CALL(ScpGetMeasureModes, ScpGetMeasureModes(__VA_ARGS__))
+#define ScpGetPreSampleRatio(...) TRACE_CALL(ScpGetPreSampleRatio, ScpGetPreSampleRatio(__VA_ARGS__))
+#define ScpGetRecordLength(...) TRACE_CALL(ScpGetRecordLength, ScpGetRecordLength(__VA_ARGS__))
+#define ScpGetRecordLengthMax(...) TRACE_CALL(ScpGetRecordLengthMax, ScpGetRecordLengthMax(__VA_ARGS__))
+#define ScpGetResolution(...) TRACE_CALL(ScpGetResolution, ScpGetResolution(__VA_ARGS__))
+#define ScpGetResolutions(...) TRACE_CALL(ScpGetResolutions, ScpGetResolutions(__VA_ARGS__))
+#define ScpGetSampleFrequency(...) TRACE_CALL(ScpGetSampleFrequency, ScpGetSampleFrequency(__VA_ARGS__))
+#define ScpGetSampleFrequencyMax(...) TRACE_CALL(ScpGetSampleFrequencyMax, ScpGetSampleFrequencyMax(__VA_ARGS__))
+#define ScpGetSegmentCount(...) TRACE_CALL(ScpGetSegmentCount, ScpGetSegmentCount(__VA_ARGS__))
+#define ScpGetSegmentCountMax(...) TRACE_CALL(ScpGetSegmentCountMax, ScpGetSegmentCountMax(__VA_ARGS__))
+#define ScpGetTriggerDelay(...) TRACE_CALL(ScpGetTriggerDelay, ScpGetTriggerDelay(__VA_ARGS__))
+#define ScpGetTriggerDelayMax(...) TRACE_CALL(ScpGetTriggerDelayMax, ScpGetTriggerDelayMax(__VA_ARGS__))
+#define ScpGetTriggerHoldOffCount(...) TRACE_CALL(ScpGetTriggerHoldOffCount, ScpGetTriggerHoldOffCount(__VA_ARGS__))
+#define ScpGetTriggerHoldOffCountMax(...) TRACE_CALL(ScpGetTriggerHoldOffCountMax, ScpGetTriggerHoldOffCountMax(__VA_ARGS__))
+#define ScpGetTriggerTimeOut(...) TRACE_CALL(ScpGetTriggerTimeOut, ScpGetTriggerTimeOut(__VA_ARGS__))
+#define ScpGetValidPreSampleCount(...) TRACE_CALL(ScpGetValidPreSampleCount, ScpGetValidPreSampleCount(__VA_ARGS__))
+#define ScpHasConnectionTest(...) TRACE_CALL(ScpHasConnectionTest, ScpHasConnectionTest(__VA_ARGS__))
+#define ScpHasTrigger(...) TRACE_CALL(ScpHasTrigger, ScpHasTrigger(__VA_ARGS__))
+#define ScpHasTriggerDelay(...) TRACE_CALL(ScpHasTriggerDelay, ScpHasTriggerDelay(__VA_ARGS__))
+#define ScpHasTriggerHoldOff(...) TRACE_CALL(ScpHasTriggerHoldOff, ScpHasTriggerHoldOff(__VA_ARGS__))
+#define ScpIsConnectionTestCompleted(...) TRACE_CALL(ScpIsConnectionTestCompleted, ScpIsConnectionTestCompleted(__VA_ARGS__))
+#define ScpIsDataOverflow(...) TRACE_CALL(ScpIsDataOverflow, ScpIsDataOverflow(__VA_ARGS__))
+#define ScpIsDataReady(...) TRACE_CALL(ScpIsDataReady, ScpIsDataReady(__VA_ARGS__))
+#define ScpIsResolutionEnhanced(...) TRACE_CALL(ScpIsResolutionEnhanced, ScpIsResolutionEnhanced(__VA_ARGS__))
+#define ScpIsRunning(...) TRACE_CALL(ScpIsRunning, ScpIsRunning(__VA_ARGS__))
+#define ScpIsTimeOutTriggered(...) TRACE_CALL(ScpIsTimeOutTriggered, ScpIsTimeOutTriggered(__VA_ARGS__))
+#define ScpIsTriggered(...) TRACE_CALL(ScpIsTriggered, ScpIsTriggered(__VA_ARGS__))
+#define ScpSetCallbackConnectionTestCompleted(...) TRACE_CALL(ScpSetCallbackConnectionTestCompleted, ScpSetCallbackConnectionTestCompleted(__VA_ARGS__))
+#define ScpSetCallbackDataOverflow(...) TRACE_CALL(ScpSetCallbackDataOverflow, ScpSetCallbackDataOverflow(__VA_ARGS__))
+#define ScpSetCallbackDataReady(...) TRACE_CALL(ScpSetCallbackDataReady, ScpSetCallbackDataReady(__VA_ARGS__))
+#define ScpSetCallbackTriggered(...) TRACE_CALL(ScpSetCallbackTriggered, ScpSetCallbackTriggered(__VA_ARGS__))
+#define ScpSetMeasureMode(...) TRACE_CALL(ScpSetMeasureMode, ScpSetMeasureMode(__VA_ARGS__))
+#define ScpSetPreSampleRatio(...) TRACE_CALL(ScpSetPreSampleRatio, ScpSetPreSampleRatio(__VA_ARGS__))
+#define ScpSetRecordLength(...) TRACE_CALL(ScpSetRecordLength, ScpSetRecordLength(__VA_ARGS__))
+#define ScpSetResolution(...) TRACE_CALL(ScpSetResolution, ScpSetResolution(__VA_ARGS__))
+#define ScpSetSampleFrequency(...) TRACE_CALL(ScpSetSampleFrequency, ScpSetSampleFrequency(__VA_ARGS__))
+#define ScpSetSegmentCount(...) TRACE_CALL(ScpSetSegmentCount, ScpSetSegmentCount(__VA_ARGS__))
+#define ScpSetTriggerDelay(...) TRACE_CALL(ScpSetTriggerDelay, ScpSetTriggerDelay(__VA_ARGS__))
+#define ScpSetTriggerHoldOffCount(...) TRACE_CALL(ScpSetTriggerHoldOffCount, ScpSetTriggerHoldOffCount(__VA_ARGS__))
+#define ScpSetTriggerTimeOut(...) TRACE_CALL(ScpSetTriggerTimeOut, ScpSetTriggerTimeOut(__VA_ARGS__))
+#define ScpStart(...) TRACE_CALL(ScpStart, ScpStart(__VA_ARGS__))
+#define ScpStartConnectionTest(...) TRACE_CALL(ScpStartConnectionTest, ScpStartConnectionTest(__VA_ARGS__))
+#define ScpStop(...) TRACE_CALL(ScpStop, ScpStop(__VA_ARGS__))
+
+#endif
+
+#endif
@@ -0,0 +1,150 @@
+/**
+ * UploadCache.c
+ *
+ * This file is part of the LibTiePie programming examples.
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#include "UploadCache.h"
+#include <string.h>
+#include <pthread.h>
+
+#define UPLOAD_CACHE_SIZE 16 // Generators.
+#define HASH_STRIPE 32 // Bytes per step, 4 lanes of 64 bit.
+#define HASH_BLOCK 1024 // Bytes between scrambles.
+
+#define PRIME32 0x9E3779B1ULL
+#define PRIME64_1 0x9E3779B185EBCA87ULL
+#define PRIME64_2 0xC2B2AE3D27D4EB4FULL
+
+typedef uint64_t v4du __attribute__((vector_size(32)));
+
+typedef struct
+{
+  LibTiePieHandle_t gen;
+  uint64_t hash;
+  uint64_t length;
+  uint32_t frequencyMode;
+  double frequency;
+} UploadCacheEntry_t;
+
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static UploadCacheEntry_t entries[UPLOAD_CACHE_SIZE];
+static unsigned int next = 0; // Entry to replace when full.
+
+static uint64_t mix(uint64_t h)
+{
+  h ^= h >> 33;
+  h *= PRIME64_2;
+  h ^= h >> 29;
+  h *= PRIME64_1;
+  h ^= h >> 32;
+  return h;
+}
+
+uint64_t hashData(const void* data, size_t size)
+{
+  static const v4du secret = {0x1CAD21F72C81017CULL, 0xDB979083E96DD4DEULL, 0x1F67B3B7A4A44072ULL, 0x78E5C0CC4EE679CBULL};
+  const unsigned char* p = data;
+  v4du acc = {PRIME32, PRIME64_1, PRIME64_2, PRIME64_1 ^ PRIME64_2};
+  size_t i = 0;
+
+  // Stripes: 32x32 bit multiplies of the keyed input, plus the input itself so zero halves don't cancel it:
+  while(i + HASH_STRIPE <= size)
+  {
+    const size_t blockEnd = i + HASH_BLOCK < size ? i + HASH_BLOCK : size;
+
+    for(; i + HASH_STRIPE <= blockEnd; i += HASH_STRIPE)
+    {
+      v4du v;
+      memcpy(&v, p + i, sizeof(v));
+      const v4du k = v ^ secret;
+      acc += (k & 0xFFFFFFFFULL) * (k >> 32) + v;
+    }
+
+    // Scramble:
+    acc ^= acc >> 47;
+    acc ^= secret;
+    acc *= PRIME32;
+  }
+
+  // Merge lanes and remaining bytes:
+  uint64_t h = size * PRIME64_1;
+  for(unsigned int lane = 0; lane < 4; lane++)
+    h = mix(h ^ acc[lane]);
+
+  for(; i < size; i++)
+    h = (h ^ p[i]) * PRIME64_1;
+
+  return mix(h);
+}
+
+static UploadCacheEntry_t* findEntry(LibTiePieHandle_t gen)
+{
+  for(unsigned int i = 0; i < UPLOAD_CACHE_SIZE; i++)
+    if(entries[i].gen == gen && entries[i].length > 0)
+      return &entries[i];
+
+  return NULL;
+}
+
+bool8_t genSetDataCached(LibTiePieHandle_t gen, const float* data, uint64_t length, LibTiePieStatus_t* status)
+{
+  const uint64_t hash = hashData(data, sizeof(float) * length);
+  const uint32_t frequencyMode = GenGetFrequencyMode(gen);
+  const double frequency = GenGetFrequency(gen);
+  UploadCacheEntry_t* entry;
+
+  pthread_mutex_lock(&lock);
+  entry = findEntry(gen);
+  if(entry && entry->hash == hash && entry->length == length && entry->frequencyMode == frequencyMode && entry->frequency == frequency)
+  {
+    pthread_mutex_unlock(&lock);
+    if(status)
+      *status = LIBTIEPIESTATUS_SUCCESS;
+    return BOOL8_FALSE;
+  }
+  pthread_mutex_unlock(&lock);
+
+  GenSetData(gen, data, length);
+  const LibTiePieStatus_t setDataStatus = LibGetLastStatus(); // Before GenGetFrequency() overwrites it.
+  const bool8_t ok = setDataStatus >= LIBTIEPIESTATUS_SUCCESS;
+
+  // Setting data can change the frequency, e.g. in signal frequency mode, so store the state after the upload:
+  const double newFrequency = GenGetFrequency(gen);
+
+  pthread_mutex_lock(&lock);
+  entry = findEntry(gen);
+  if(ok)
+  {
+    if(!entry)
+    {
+      entry = &entries[next];
+      next = (next + 1) % UPLOAD_CACHE_SIZE;
+    }
+
+    entry->gen = gen;
+    entry->hash = hash;
+    entry->length = length;
+    entry->frequencyMode = frequencyMode;
+    entry->frequency = newFrequency;
+  }
+  else if(entry)
+    memset(entry, 0, sizeof(UploadCacheEntry_t)); // Generator data unknown now.
+  pthread_mutex_unlock(&lock);
+
+  if(status)
+    *status = setDataStatus;
+
+  return BOOL8_TRUE;
+}
+
+void genInvalidateDataCache(LibTiePieHandle_t gen)
+{
+  pthread_mutex_lock(&lock);
+  UploadCacheEntry_t* entry = findEntry(gen);
+  if(entry)
+    memset(entry, 0, sizeof(UploadCacheEntry_t));
+  pthread_mutex_unlock(&lock);
+}
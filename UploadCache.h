@@ -0,0 +1,29 @@
+/**
+ * UploadCache.h
+ *
+ * This file is part of the LibTiePie programming examples.
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#ifndef _UPLOADCACHE_H_
+#define _UPLOADCACHE_H_
+
+#include <stddef.h>
+#include <libtiepie.h>
+
+// Skips GenSetData() calls that would upload the data the generator already has.
+// Per generator handle the hash and length of the last upload are kept, together with the frequency mode and frequency
+// at that time. Hashing runs at memory speed, so checking costs far less than a transfer to the instrument.
+
+// Upload data unless it is unchanged, returns BOOL8_TRUE if GenSetData() is called.
+// status receives the status of GenSetData(), or LIBTIEPIESTATUS_SUCCESS if skipped, it may be NULL:
+bool8_t genSetDataCached(LibTiePieHandle_t gen, const float* data, uint64_t length, LibTiePieStatus_t* status);
+
+// Forget the last upload, call before closing the generator or when its data is changed otherwise:
+void genInvalidateDataCache(LibTiePieHandle_t gen);
+
+// 64 bit hash, four lanes at a time:
+uint64_t hashData(const void* data, size_t size);
+
+#endif
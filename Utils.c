@@ -12,8 +12,10 @@
 #  include <conio.h>
 #else // POSIX
 #  include <unistd.h>
+#  include <errno.h>
 #  include <stdio.h>
 #  include <termios.h>
+#  include <time.h>
 #endif
 
 void sleepMiliSeconds(unsigned int ms)
@@ -25,6 +27,59 @@ void sleepMiliSeconds(unsigned int ms)
 #endif
 }
 
+uint64_t getTimeNanoSeconds()
+{
+#ifdef OS_WINDOWS
+  static LARGE_INTEGER frequency;
+  LARGE_INTEGER counter;
+
+  if(frequency.QuadPart == 0)
+    QueryPerformanceFrequency(&frequency);
+  QueryPerformanceCounter(&counter);
+
+  return (uint64_t)((counter.QuadPart / frequency.QuadPart) * 1000000000ULL + ((counter.QuadPart % frequency.QuadPart) * 1000000000ULL) / frequency.QuadPart);
+#else // POSIX
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+
+  return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+#endif
+}
+
+void sleepUntil(uint64_t time)
+{
+#ifdef OS_WINDOWS
+  // Sleep() has millisecond resolution, spin for the last part:
+  uint64_t now = getTimeNanoSeconds();
+  if(now + 2000000 < time)
+    Sleep((DWORD)((time - now) / 1000000 - 1));
+  while(getTimeNanoSeconds() < time)
+    ;
+#else // POSIX
+  struct timespec ts;
+  ts.tv_sec = time / 1000000000ULL;
+  ts.tv_nsec = time % 1000000000ULL;
+
+  // Absolute time, restart when interrupted by a signal:
+  while(clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR)
+    ;
+#endif
+}
+
+unsigned int getProcessorCount()
+{
+#ifdef OS_WINDOWS
+  SYSTEM_INFO info;
+  GetSystemInfo(&info);
+
+  return info.dwNumberOfProcessors;
+#else // POSIX
+  const long count = sysconf(_SC_NPROCESSORS_ONLN);
+
+  return count > 0 ? (unsigned int)count : 1;
+#endif
+}
+
 void waitForKeyStroke()
 {
 #ifdef OS_WINDOWS
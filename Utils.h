@@ -16,7 +16,12 @@
 #  define NEWLINE "\n"
 #endif
 
+#include <stdint.h>
+
 void sleepMiliSeconds(unsigned int ms);
+uint64_t getTimeNanoSeconds(); // Monotonic clock, for measuring intervals.
+void sleepUntil(uint64_t time); // Sleep until getTimeNanoSeconds() reaches time.
+unsigned int getProcessorCount();
 void waitForKeyStroke();
 
 #endif
@@ -0,0 +1,163 @@
+/**
+ * WaveformFile.c
+ *
+ * This file is part of the LibTiePie programming examples.
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#include "WaveformFile.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "Parallel.h"
+#include "Utils.h"
+#ifdef OS_WINDOWS
+#  include <windows.h>
+#else // POSIX
+#  include <fcntl.h>
+#  include <unistd.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#endif
+
+#define CONVERT_BLOCK 65536 // Samples.
+#define CONVERT_PARALLEL_MIN (1 << 20)
+
+typedef struct
+{
+  const int16_t* source;
+  float* destination;
+} ConvertJob_t;
+
+static void convertInt16(uint64_t start, uint64_t end, void* arg)
+{
+  const ConvertJob_t* job = arg;
+  const int16_t* source = job->source;
+  float* destination = job->destination;
+
+  // Simple enough for the compiler to vectorize:
+  for(uint64_t i = start; i < end; i++)
+    destination[i] = source[i] * (1.0f / 32768.0f);
+}
+
+static bool8_t mapFile(WaveformFile_t* waveform, const char* filename)
+{
+#ifdef OS_WINDOWS
+  LARGE_INTEGER size;
+
+  waveform->file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+  if(waveform->file == INVALID_HANDLE_VALUE)
+  {
+    waveform->file = NULL;
+    return BOOL8_FALSE;
+  }
+
+  if(!GetFileSizeEx(waveform->file, &size) || size.QuadPart == 0)
+    return BOOL8_FALSE;
+  waveform->mappingSize = (size_t)size.QuadPart;
+
+  waveform->fileMapping = CreateFileMappingA(waveform->file, NULL, PAGE_READONLY, 0, 0, NULL);
+  if(!waveform->fileMapping)
+    return BOOL8_FALSE;
+
+  waveform->mapping = MapViewOfFile(waveform->fileMapping, FILE_MAP_READ, 0, 0, 0);
+  return waveform->mapping != NULL;
+#else // POSIX
+  struct stat st;
+  const int fd = open(filename, O_RDONLY);
+  if(fd < 0)
+    return BOOL8_FALSE;
+
+  if(fstat(fd, &st) != 0 || st.st_size == 0)
+  {
+    close(fd);
+    return BOOL8_FALSE;
+  }
+  waveform->mappingSize = (size_t)st.st_size;
+
+  // The mapping stays valid after closing the file:
+  void* mapping = mmap(NULL, waveform->mappingSize, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if(mapping == MAP_FAILED)
+    return BOOL8_FALSE;
+
+  // Read ahead, every page is read exactly once. Advice values aren't flags, give each separately:
+  madvise(mapping, waveform->mappingSize, MADV_SEQUENTIAL);
+  madvise(mapping, waveform->mappingSize, MADV_WILLNEED);
+
+  waveform->mapping = mapping;
+  return BOOL8_TRUE;
+#endif
+}
+
+bool8_t openWaveformFile(WaveformFile_t* waveform, const char* filename, int format)
+{
+  memset(waveform, 0, sizeof(WaveformFile_t));
+
+  if(!mapFile(waveform, filename))
+  {
+    fprintf(stderr, "Couldn't open file: %s" NEWLINE, filename);
+    closeWaveformFile(waveform);
+    return BOOL8_FALSE;
+  }
+
+  if(format == WAVEFORM_FLOAT32)
+  {
+    waveform->data = waveform->mapping;
+    waveform->length = waveform->mappingSize / sizeof(float);
+  }
+  else if(format == WAVEFORM_INT16)
+  {
+    ConvertJob_t job;
+
+    waveform->length = waveform->mappingSize / sizeof(int16_t);
+    waveform->converted = malloc(sizeof(float) * waveform->length);
+    if(!waveform->converted)
+    {
+      fprintf(stderr, "Couldn't allocate conversion buffer!" NEWLINE);
+      closeWaveformFile(waveform);
+      return BOOL8_FALSE;
+    }
+
+    job.source = waveform->mapping;
+    job.destination = waveform->converted;
+    parallelFor(waveform->length, CONVERT_BLOCK, CONVERT_PARALLEL_MIN, convertInt16, &job);
+
+    waveform->data = waveform->converted;
+  }
+  else
+  {
+    fprintf(stderr, "Unknown waveform format: %d" NEWLINE, format);
+    closeWaveformFile(waveform);
+    return BOOL8_FALSE;
+  }
+
+  if(waveform->length == 0)
+  {
+    fprintf(stderr, "File too small: %s" NEWLINE, filename);
+    closeWaveformFile(waveform);
+    return BOOL8_FALSE;
+  }
+
+  return BOOL8_TRUE;
+}
+
+void closeWaveformFile(WaveformFile_t* waveform)
+{
+  free(waveform->converted);
+
+#ifdef OS_WINDOWS
+  if(waveform->mapping)
+    UnmapViewOfFile(waveform->mapping);
+  if(waveform->fileMapping)
+    CloseHandle(waveform->fileMapping);
+  if(waveform->file)
+    CloseHandle(waveform->file);
+#else // POSIX
+  if(waveform->mapping)
+    munmap(waveform->mapping, waveform->mappingSize);
+#endif
+
+  memset(waveform, 0, sizeof(WaveformFile_t));
+}
@@ -0,0 +1,41 @@
+/**
+ * WaveformFile.h
+ *
+ * This file is part of the LibTiePie programming examples.
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#ifndef _WAVEFORMFILE_H_
+#define _WAVEFORMFILE_H_
+
+#include <stddef.h>
+#include <libtiepie.h>
+#include "Utils.h" // for OS_WINDOWS
+
+// Arbitrary waveforms from raw sample files, in native byte order, without header.
+// The file is memory mapped: float32 files are passed to GenSetData() straight from the mapping,
+// int16 files are converted to -1..1 floats on all processors, in a single pass over the file.
+
+// File formats:
+#define WAVEFORM_FLOAT32 0
+#define WAVEFORM_INT16 1
+
+typedef struct
+{
+  const float* data; // Samples for GenSetData().
+  uint64_t length;
+  void* mapping;
+  size_t mappingSize;
+  float* converted; // Conversion buffer, NULL for float32 files.
+#ifdef OS_WINDOWS
+  void* file;
+  void* fileMapping;
+#endif
+} WaveformFile_t;
+
+// Open a waveform file, errors are printed to stderr. Returns BOOL8_FALSE on error.
+bool8_t openWaveformFile(WaveformFile_t* waveform, const char* filename, int format);
+void closeWaveformFile(WaveformFile_t* waveform);
+
+#endif
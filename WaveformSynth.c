@@ -0,0 +1,367 @@
+/**
+ * WaveformSynth.c
+ *
+ * This file is part of the LibTiePie programming examples.
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#include "WaveformSynth.h"
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "Parallel.h"
+
+#define SYNTH_LANES 4
+#define SYNTH_BLOCK 4096 // Samples, phases and envelopes are recalculated exactly at each block start.
+#define SYNTH_PARALLEL_MIN (1 << 20) // Shorter waveforms are generated on the calling thread.
+#define SYNTH_TONE_MAX 32
+
+#ifndef M_PI
+#  define M_PI 3.14159265358979323846
+#endif
+
+typedef float v4sf __attribute__((vector_size(16)));
+typedef int32_t v4si __attribute__((vector_size(16)));
+typedef uint32_t v4su __attribute__((vector_size(16)));
+typedef int64_t v4di __attribute__((vector_size(32)));
+typedef uint64_t v4du __attribute__((vector_size(32)));
+
+static const v4du lanes = {0, 1, 2, 3};
+
+typedef void (*SynthKernel_t)(float* data, uint64_t start, uint64_t end, const void* params);
+
+typedef struct
+{
+  SynthKernel_t kernel;
+  float* data;
+  const void* params;
+} SynthJob_t;
+
+// Phase increment for a frequency, 2^64 is one period:
+static uint64_t toPhase(double cycles)
+{
+  const double x = (cycles - floor(cycles)) * 18446744073709551616.0;
+  return x >= 18446744073709551616.0 ? 0 : (uint64_t)x;
+}
+
+// sin(2 pi phase / 2^32):
+static inline v4sf sinPhase(v4su phase)
+{
+  // Fold to -0.5..0.5, so that sin(2 pi x) = sin(pi y):
+  const v4si a = (v4si)(phase - 0x40000000u);
+  const v4si abs = a ^ (a >> 31);
+  const v4sf y = 0.5f - __builtin_convertvector(abs, v4sf) * (1.0f / 2147483648.0f);
+  const v4sf y2 = y * y;
+
+  // Taylor series of sin(pi y), error < 1e-7 for |y| <= 0.5:
+  return y * (3.14159265f + y2 * (-5.16771278f + y2 * (2.55016404f + y2 * (-0.599264529f + y2 * (0.0821458866f + y2 * -0.00737043094f)))));
+}
+
+// Upper half of a 64 bit phase:
+#define PHASE32(phase) __builtin_convertvector((phase) >> 32, v4su)
+
+static inline void store(float* data, uint64_t i, uint64_t end, v4sf value)
+{
+  if(i + SYNTH_LANES <= end)
+    memcpy(data + i, &value, sizeof(value));
+  else
+    memcpy(data + i, &value, sizeof(float) * (end - i));
+}
+
+static inline v4sf load(const float* data, uint64_t i, uint64_t end)
+{
+  v4sf value = {0};
+
+  if(i + SYNTH_LANES <= end)
+    memcpy(&value, data + i, sizeof(value));
+  else
+    memcpy(&value, data + i, sizeof(float) * (end - i));
+
+  return value;
+}
+
+static void runKernel(uint64_t start, uint64_t end, void* arg)
+{
+  const SynthJob_t* job = arg;
+  job->kernel(job->data, start, end, job->params);
+}
+
+// Split the waveform in equal parts of whole blocks, one per processor:
+static void runParallel(SynthKernel_t kernel, float* data, uint64_t length, const void* params)
+{
+  SynthJob_t job = {kernel, data, params};
+  parallelFor(length, SYNTH_BLOCK, SYNTH_PARALLEL_MIN, runKernel, &job);
+}
+
+float* createWaveformBuffer(LibTiePieHandle_t gen, uint64_t* length)
+{
+  *length = GenGetDataLengthMax(gen);
+  if(*length == 0)
+    return NULL;
+
+  return malloc(sizeof(float) * *length);
+}
+
+// Multitone:
+
+typedef struct
+{
+  unsigned int count;
+  uint64_t increments[SYNTH_TONE_MAX];
+  uint64_t phases[SYNTH_TONE_MAX];
+  float amplitudes[SYNTH_TONE_MAX];
+} MultitoneParams_t;
+
+static void multitoneKernel(float* data, uint64_t start, uint64_t end, const void* arg)
+{
+  const MultitoneParams_t* params = arg;
+
+  for(uint64_t block = start; block < end; block += SYNTH_BLOCK)
+  {
+    const uint64_t blockEnd = block + SYNTH_BLOCK < end ? block + SYNTH_BLOCK : end;
+
+    for(unsigned int t = 0; t < params->count; t++)
+    {
+      const uint64_t increment = params->increments[t];
+      const v4du step = (v4du){0} + increment * SYNTH_LANES;
+      const float amplitude = params->amplitudes[t];
+      v4du phase = params->phases[t] + (block + lanes) * increment;
+
+      for(uint64_t i = block; i < blockEnd; i += SYNTH_LANES)
+      {
+        v4sf value = amplitude * sinPhase(PHASE32(phase));
+        if(t > 0)
+          value += load(data, i, blockEnd);
+        store(data, i, blockEnd, value);
+        phase += step;
+      }
+    }
+  }
+}
+
+void synthMultitone(float* data, uint64_t length, double sampleFrequency, const SynthTone_t* tones, unsigned int toneCount)
+{
+  MultitoneParams_t params;
+
+  if(toneCount == 0)
+  {
+    memset(data, 0, sizeof(float) * length);
+    return;
+  }
+
+  params.count = toneCount < SYNTH_TONE_MAX ? toneCount : SYNTH_TONE_MAX;
+  for(unsigned int t = 0; t < params.count; t++)
+  {
+    params.increments[t] = toPhase(tones[t].frequency / sampleFrequency);
+    params.phases[t] = toPhase(tones[t].phase);
+    params.amplitudes[t] = (float)tones[t].amplitude;
+  }
+
+  runParallel(multitoneKernel, data, length, &params);
+}
+
+// Chirp:
+
+typedef struct
+{
+  uint64_t increment; // At sample 0.
+  uint64_t delta; // Increment change per sample.
+  float amplitude;
+} ChirpParams_t;
+
+static void chirpKernel(float* data, uint64_t start, uint64_t end, const void* arg)
+{
+  const ChirpParams_t* params = arg;
+  const v4du step = (v4du){0} + params->delta * SYNTH_LANES;
+  const v4du stepSum = (v4du){0} + params->delta * (SYNTH_LANES * (SYNTH_LANES - 1) / 2);
+
+  for(uint64_t block = start; block < end; block += SYNTH_BLOCK)
+  {
+    const uint64_t blockEnd = block + SYNTH_BLOCK < end ? block + SYNTH_BLOCK : end;
+
+    // phase(n) = n * increment + n * (n - 1) / 2 * delta, increment(n) = increment + n * delta:
+    const v4du n = block + lanes;
+    v4du phase = n * params->increment + ((n * (n - 1)) >> 1) * params->delta;
+    v4du increment = params->increment + n * params->delta;
+
+    for(uint64_t i = block; i < blockEnd; i += SYNTH_LANES)
+    {
+      store(data, i, blockEnd, params->amplitude * sinPhase(PHASE32(phase)));
+
+      // Sum of the next four increments:
+      phase += increment * SYNTH_LANES + stepSum;
+      increment += step;
+    }
+  }
+}
+
+void synthChirp(float* data, uint64_t length, double sampleFrequency, double startFrequency, double stopFrequency, double amplitude)
+{
+  ChirpParams_t params;
+
+  params.increment = toPhase(startFrequency / sampleFrequency);
+  params.delta = toPhase((stopFrequency - startFrequency) / sampleFrequency / (length > 1 ? length - 1 : 1));
+  params.amplitude = (float)amplitude;
+
+  runParallel(chirpKernel, data, length, &params);
+}
+
+// AM and FM:
+
+typedef struct
+{
+  uint64_t carrier;
+  uint64_t modulation;
+  float depth; // AM: modulation depth, FM: modulation index in 2^32 phase units.
+  float amplitude;
+} ModulationParams_t;
+
+static void amKernel(float* data, uint64_t start, uint64_t end, const void* arg)
+{
+  const ModulationParams_t* params = arg;
+  const v4du carrierStep = (v4du){0} + params->carrier * SYNTH_LANES;
+  const v4du modulationStep = (v4du){0} + params->modulation * SYNTH_LANES;
+  const float scale = params->amplitude / (1 + params->depth);
+
+  for(uint64_t block = start; block < end; block += SYNTH_BLOCK)
+  {
+    const uint64_t blockEnd = block + SYNTH_BLOCK < end ? block + SYNTH_BLOCK : end;
+    v4du carrier = (block + lanes) * params->carrier;
+    v4du modulation = (block + lanes) * params->modulation;
+
+    for(uint64_t i = block; i < blockEnd; i += SYNTH_LANES)
+    {
+      const v4sf envelope = 1 + params->depth * sinPhase(PHASE32(modulation));
+      store(data, i, blockEnd, scale * envelope * sinPhase(PHASE32(carrier)));
+      carrier += carrierStep;
+      modulation += modulationStep;
+    }
+  }
+}
+
+static void fmKernel(float* data, uint64_t start, uint64_t end, const void* arg)
+{
+  const ModulationParams_t* params = arg;
+  const v4du carrierStep = (v4du){0} + params->carrier * SYNTH_LANES;
+  const v4du modulationStep = (v4du){0} + params->modulation * SYNTH_LANES;
+
+  for(uint64_t block = start; block < end; block += SYNTH_BLOCK)
+  {
+    const uint64_t blockEnd = block + SYNTH_BLOCK < end ? block + SYNTH_BLOCK : end;
+    v4du carrier = (block + lanes) * params->carrier;
+    v4du modulation = (block + lanes) * params->modulation;
+
+    for(uint64_t i = block; i < blockEnd; i += SYNTH_LANES)
+    {
+      // Phase offset in 2^32 units, added to the upper half of the carrier phase:
+      const v4di offset = __builtin_convertvector(params->depth * sinPhase(PHASE32(modulation)), v4di);
+      store(data, i, blockEnd, params->amplitude * sinPhase(PHASE32(carrier + ((v4du)offset << 32))));
+      carrier += carrierStep;
+      modulation += modulationStep;
+    }
+  }
+}
+
+void synthAM(float* data, uint64_t length, double sampleFrequency, double carrierFrequency, double modulationFrequency, double depth, double amplitude)
+{
+  ModulationParams_t params;
+
+  params.carrier = toPhase(carrierFrequency / sampleFrequency);
+  params.modulation = toPhase(modulationFrequency / sampleFrequency);
+  params.depth = (float)depth;
+  params.amplitude = (float)amplitude;
+
+  runParallel(amKernel, data, length, &params);
+}
+
+void synthFM(float* data, uint64_t length, double sampleFrequency, double carrierFrequency, double modulationFrequency, double deviation, double amplitude)
+{
+  ModulationParams_t params;
+
+  // Integral of deviation * cos(2 pi fm t) is deviation / (2 pi fm) * sin(2 pi fm t) periods:
+  params.carrier = toPhase(carrierFrequency / sampleFrequency);
+  params.modulation = toPhase(modulationFrequency / sampleFrequency);
+  params.depth = (float)(deviation / (2 * M_PI * modulationFrequency) * 4294967296.0);
+  params.amplitude = (float)amplitude;
+
+  runParallel(fmKernel, data, length, &params);
+}
+
+// Damped sine:
+
+typedef struct
+{
+  uint64_t increment;
+  double decay; // Per sample, exp(-1 / (fs * tau)) = exp(-decay).
+  float amplitude;
+} DampedSineParams_t;
+
+static void dampedSineKernel(float* data, uint64_t start, uint64_t end, const void* arg)
+{
+  const DampedSineParams_t* params = arg;
+  const v4du step = (v4du){0} + params->increment * SYNTH_LANES;
+  const float decayStep = (float)exp(-params->decay * SYNTH_LANES);
+
+  for(uint64_t block = start; block < end; block += SYNTH_BLOCK)
+  {
+    const uint64_t blockEnd = block + SYNTH_BLOCK < end ? block + SYNTH_BLOCK : end;
+    v4du phase = (block + lanes) * params->increment;
+    v4sf envelope;
+
+    for(unsigned int lane = 0; lane < SYNTH_LANES; lane++)
+      envelope[lane] = params->amplitude * (float)exp(-params->decay * (block + lane));
+
+    for(uint64_t i = block; i < blockEnd; i += SYNTH_LANES)
+    {
+      store(data, i, blockEnd, envelope * sinPhase(PHASE32(phase)));
+      phase += step;
+      envelope *= decayStep;
+    }
+  }
+}
+
+void synthDampedSine(float* data, uint64_t length, double sampleFrequency, double frequency, double timeConstant, double amplitude)
+{
+  DampedSineParams_t params;
+
+  params.increment = toPhase(frequency / sampleFrequency);
+  params.decay = 1 / (sampleFrequency * timeConstant);
+  params.amplitude = (float)amplitude;
+
+  runParallel(dampedSineKernel, data, length, &params);
+}
+
+// PRBS:
+
+bool8_t synthPRBS(float* data, uint64_t length, unsigned int order, uint64_t samplesPerBit, double amplitude)
+{
+  // Feedback taps of maximum length sequences, x^order + x^tap + 1:
+  static const unsigned int taps[][2] = {{7, 6}, {9, 5}, {11, 9}, {15, 14}, {20, 3}, {23, 18}, {31, 28}};
+  unsigned int tap = 0;
+
+  for(unsigned int i = 0; i < sizeof(taps) / sizeof(taps[0]); i++)
+    if(taps[i][0] == order)
+      tap = taps[i][1];
+
+  if(tap == 0 || samplesPerBit == 0)
+    return BOOL8_FALSE;
+
+  const float levels[2] = {(float)-amplitude, (float)amplitude};
+  uint32_t state = (1UL << order) - 1; // All ones.
+  uint64_t i = 0;
+
+  while(i < length)
+  {
+    const uint32_t bit = ((state >> (order - 1)) ^ (state >> (tap - 1))) & 1;
+    state = ((state << 1) | bit) & ((1UL << order) - 1);
+
+    // Fill a run of samples, the compiler turns this into vector stores:
+    const uint64_t runEnd = i + samplesPerBit < length ? i + samplesPerBit : length;
+    const float level = levels[bit];
+    for(; i < runEnd; i++)
+      data[i] = level;
+  }
+
+  return BOOL8_TRUE;
+}
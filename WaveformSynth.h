@@ -0,0 +1,48 @@
+/**
+ * WaveformSynth.h
+ *
+ * This file is part of the LibTiePie programming examples.
+ *
+ * Find more information on http://www.tiepie.com/LibTiePie .
+ */
+
+#ifndef _WAVEFORMSYNTH_H_
+#define _WAVEFORMSYNTH_H_
+
+#include <libtiepie.h>
+
+// Synthesis of arbitrary waveforms for GenSetData().
+// The sine based waveforms use 64 bit phase accumulators and a polynomial sine, four samples at a time,
+// long waveforms are generated on all processors. Frequencies are in Hz at the given sample frequency,
+// phases are a fraction of a period (0..1), like GenSetPhase().
+
+typedef struct
+{
+  double frequency;
+  double amplitude;
+  double phase;
+} SynthTone_t;
+
+// Allocate a buffer of the generators maximum data length, returns NULL on error:
+float* createWaveformBuffer(LibTiePieHandle_t gen, uint64_t* length);
+
+// Sum of sines:
+void synthMultitone(float* data, uint64_t length, double sampleFrequency, const SynthTone_t* tones, unsigned int toneCount);
+
+// Linear frequency sweep:
+void synthChirp(float* data, uint64_t length, double sampleFrequency, double startFrequency, double stopFrequency, double amplitude);
+
+// Amplitude modulated sine, depth 0..1, the peak value is amplitude:
+void synthAM(float* data, uint64_t length, double sampleFrequency, double carrierFrequency, double modulationFrequency, double depth, double amplitude);
+
+// Frequency modulated sine, deviation is the peak frequency deviation in Hz:
+void synthFM(float* data, uint64_t length, double sampleFrequency, double carrierFrequency, double modulationFrequency, double deviation, double amplitude);
+
+// Exponentially decaying sine, timeConstant in seconds:
+void synthDampedSine(float* data, uint64_t length, double sampleFrequency, double frequency, double timeConstant, double amplitude);
+
+// Pseudo random bit sequence of -amplitude/+amplitude, order is 7, 9, 11, 15, 20, 23 or 31.
+// Returns BOOL8_FALSE for an unsupported order.
+bool8_t synthPRBS(float* data, uint64_t length, unsigned int order, uint64_t samplesPerBit, double amplitude);
+
+#endif